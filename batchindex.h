@@ -0,0 +1,269 @@
+#ifndef BATCHINDEX_H
+#define BATCHINDEX_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "common.h"
+#include "entity.h"
+#include "intrusivelist.h"
+#include "variantmap.h"
+
+namespace xsim {
+
+class Node;
+
+/**
+ * @brief Tag of the intrusive lists that queue blocked entities per
+ * destination and variant in a BatchIndex.
+ */
+struct BatchLink {};
+
+/**
+ * @brief An entity waiting in a batch queue. An entity blocked at several
+ * destinations has one entry per destination.
+ */
+struct BatchQueueEntry : public IntrusiveListHook<BatchLink> {
+    Entity *entity = nullptr;
+    Variant *variant = nullptr;
+    size_t destination = 0;
+};
+
+/**
+ * @brief Finds the entities for new batches without scanning the block list.
+ *
+ * The entities that are blocked by a Batch are queued per destination and
+ * variant in block order, and each destination counts the variants that
+ * have enough entities waiting for a complete batch. Checking whether a
+ * batch can start at a destination is then O(1), and assembling a batch
+ * visits only the entities that go into it.
+ *
+ * What a complete batch of a variant needs is not fixed: a variant can
+ * occur several times in the batch order with different sizes, a size can
+ * be an expression and with demand it is the demand of the stores. The
+ * batch sets the requirement of the current batch item or demand of each
+ * variant, and sets it again whenever the batch advances or the demand
+ * changes, which recounts only that variant.
+ */
+class BatchIndex {
+public:
+    BatchIndex() = default;
+
+    /** Copying and moving the index is not supported. */
+    BatchIndex(const BatchIndex&) = delete;
+    BatchIndex& operator=(const BatchIndex&) = delete;
+
+    /**
+     * @brief Sets the number of entities a complete batch of a variant needs
+     * now, the size of its current batch item or its demand.
+     *
+     * @param variant The variant.
+     * @param size    The required number of entities, zero if no batch of
+     *                the variant can start.
+     */
+    void set_requirement(Variant *variant, size_t size)
+    {
+        size_t& required = requirements_[variant];
+        if (required == size)
+            return;
+        for (Destination& destination : destinations_) {
+            const Slot *slot = destination.slots.find(variant);
+            if (!slot)
+                continue;
+            bool was = is_complete(slot->count, required);
+            bool is = is_complete(slot->count, size);
+            if (was != is) {
+                if (is)
+                    ++destination.complete;
+                else
+                    --destination.complete;
+            }
+        }
+        required = size;
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The number of entities a complete batch of the variant needs now.
+     */
+    size_t requirement(Variant *variant) const
+    {
+        const size_t *size = requirements_.find(variant);
+        return size ? *size : 0;
+    }
+
+    /**
+     * @param node A destination node.
+     *
+     * @returns The dense index of the destination, added if it is new.
+     */
+    size_t destination(Node *node)
+    {
+        auto it = destination_index_.find(node);
+        if (it != destination_index_.end())
+            return it->second;
+        destination_index_.emplace(node, destinations_.size());
+        destinations_.emplace_back();
+        destinations_.back().node = node;
+        return destinations_.size() - 1;
+    }
+
+    /**
+     * @brief Queues a blocked entity at a destination.
+     *
+     * @param destination The index of the destination.
+     * @param variant     The variant of the entity.
+     * @param entity      The entity.
+     *
+     * @returns The entry, kept by the caller to remove the entity.
+     */
+    BatchQueueEntry* add(size_t destination, Variant *variant, Entity *entity)
+    {
+        BatchQueueEntry *entry = allocate();
+        entry->entity = entity;
+        entry->variant = variant;
+        entry->destination = destination;
+        Slot& slot = this->slot(destination, variant);
+        queues_[slot.queue].push_back(entry);
+        size_t required = requirement(variant);
+        size_t before = slot.count++;
+        if (!is_complete(before, required) && is_complete(slot.count, required))
+            ++destinations_[destination].complete;
+        return entry;
+    }
+
+    /**
+     * @brief Removes a queued entity.
+     *
+     * @param entry The entry returned by add.
+     */
+    void remove(BatchQueueEntry *entry)
+    {
+        if (!entry->is_linked())
+            return;
+        Slot& slot = this->slot(entry->destination, entry->variant);
+        queues_[slot.queue].remove(entry);
+        size_t required = requirement(entry->variant);
+        size_t before = slot.count--;
+        if (is_complete(before, required) && !is_complete(slot.count, required))
+            --destinations_[entry->destination].complete;
+        free_.push_back(entry);
+    }
+
+    /**
+     * @param destination The index of the destination.
+     * @param variant     The variant.
+     *
+     * @returns The number of entities of the variant waiting for the destination.
+     */
+    size_t ready(size_t destination, Variant *variant) const
+    {
+        const Slot *slot = destinations_[destination].slots.find(variant);
+        return slot ? slot->count : 0;
+    }
+
+    /**
+     * @param destination The index of the destination.
+     *
+     * @returns True if a complete batch of some variant can start at the destination.
+     */
+    bool batch_possible(size_t destination) const
+    {
+        return destinations_[destination].complete > 0;
+    }
+
+    /**
+     * @brief Collects the first entities of a variant for a batch.
+     *
+     * @param destination The index of the destination.
+     * @param variant     The variant.
+     * @param count       The maximum number of entities.
+     * @param entities    Receives the entities in block order.
+     */
+    void take(size_t destination, Variant *variant, size_t count, std::vector<Entity*>& entities) const
+    {
+        entities.clear();
+        const Slot *slot = destinations_[destination].slots.find(variant);
+        if (!slot)
+            return;
+        for (BatchQueueEntry *entry : queues_[slot->queue]) {
+            if (entities.size() == count)
+                break;
+            entities.push_back(entry->entity);
+        }
+    }
+
+    /**
+     * @brief Removes all entities and destinations, and the entries the
+     * queued entities refer to in EntityCold::batch_entries.
+     */
+    void clear()
+    {
+        for (auto& queue : queues_) {
+            for (BatchQueueEntry *entry : queue)
+                if (EntityCold *cold = entry->entity->cold())
+                    cold->batch_entries.clear();
+            queue.clear();
+        }
+        queues_.clear();
+        destinations_.clear();
+        destination_index_.clear();
+        free_.clear();
+        entries_.clear();
+        requirements_.clear();
+    }
+
+private:
+    struct Slot {
+        size_t count = 0;
+        size_t queue = 0;
+    };
+
+    struct Destination {
+        Node *node = nullptr;
+        VariantMap<Slot> slots;
+        /** @brief The number of variants with a complete batch waiting. */
+        size_t complete = 0;
+    };
+
+    static bool is_complete(size_t count, size_t required)
+    {
+        return required > 0 && count >= required;
+    }
+
+    Slot& slot(size_t destination, Variant *variant)
+    {
+        VariantMap<Slot>& slots = destinations_[destination].slots;
+        if (!slots.contains(variant)) {
+            slots[variant].queue = queues_.size();
+            queues_.emplace_back();
+        }
+        return slots[variant];
+    }
+
+    BatchQueueEntry* allocate()
+    {
+        if (!free_.empty()) {
+            BatchQueueEntry *entry = free_.back();
+            free_.pop_back();
+            return entry;
+        }
+        entries_.emplace_back();
+        return &entries_.back();
+    }
+
+    std::vector<Destination> destinations_;
+    std::unordered_map<Node*, size_t> destination_index_;
+    std::deque<IntrusiveList<BatchQueueEntry, BatchLink>> queues_;
+    VariantMap<size_t> requirements_;
+    std::deque<BatchQueueEntry> entries_;
+    std::vector<BatchQueueEntry*> free_;
+};
+
+} // namespace xsim
+
+#endif // BATCHINDEX_H
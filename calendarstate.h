@@ -0,0 +1,253 @@
+#ifndef CALENDARSTATE_H
+#define CALENDARSTATE_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace xsim {
+
+class Node;
+
+/**
+ * @brief The shared state of a shift calendar that its nodes read lazily.
+ *
+ * A shift or break boundary only changes the mode, bumps the epoch and
+ * records the transition, which is O(1) however many nodes follow the
+ * calendar. A node remembers the epoch it last saw and replays the
+ * transitions since then when it next acts, see CalendarView.
+ */
+class CalendarState {
+public:
+    /** @brief The mode the calendar imposes on its nodes. */
+    enum Mode { WORKING, UNPLANNED, PAUSED };
+
+    /** @brief A change of mode at a boundary. */
+    struct Transition {
+        simtime time;
+        Mode from;
+        Mode to;
+    };
+
+    CalendarState() = default;
+
+    /**
+     * @brief Changes the mode at a shift or break boundary.
+     *
+     * @param mode The new mode.
+     * @param now  The current simulation time.
+     */
+    void set_mode(Mode mode, simtime now)
+    {
+        accumulate(now);
+        if (mode == mode_)
+            return;
+        transitions_.push_back(Transition{ now, mode_, mode });
+        mode_ = mode;
+        ++epoch_;
+    }
+
+    /**
+     * @returns The current mode.
+     */
+    Mode mode() const { return mode_; }
+
+    /**
+     * @returns The number of mode changes since the simulation was initialized.
+     */
+    uint64_t epoch() const { return epoch_; }
+
+    /**
+     * @param epoch An epoch since the calendar was last reset.
+     *
+     * @returns The transitions after @p epoch in time order, the first is at
+     * the returned pointer and there are epoch() - @p epoch of them.
+     */
+    const Transition* transitions_since(uint64_t epoch) const
+    {
+        return transitions_.data() + (epoch - base_epoch_);
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns The total time in the unplanned mode until @p now.
+     */
+    simtime unplanned_time(simtime now) const
+    {
+        return unplanned_time_ + (mode_ == UNPLANNED ? now - since_ : 0);
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns The total time in the paused mode until @p now.
+     */
+    simtime paused_time(simtime now) const
+    {
+        return paused_time_ + (mode_ == PAUSED ? now - since_ : 0);
+    }
+
+    /**
+     * @brief Restarts in the working mode, called when the simulation is
+     * initialized. The transitions are dropped, so the nodes must attach again.
+     *
+     * @param now The current simulation time.
+     */
+    void reset(simtime now)
+    {
+        mode_ = WORKING;
+        ++epoch_;
+        base_epoch_ = epoch_;
+        transitions_.clear();
+        since_ = now;
+        unplanned_time_ = 0;
+        paused_time_ = 0;
+    }
+
+private:
+    void accumulate(simtime now)
+    {
+        if (mode_ == UNPLANNED)
+            unplanned_time_ += now - since_;
+        else if (mode_ == PAUSED)
+            paused_time_ += now - since_;
+        since_ = now;
+    }
+
+    Mode mode_ = WORKING;
+    uint64_t epoch_ = 0;
+    /** @brief The epoch of the last reset, the first transition follows it. */
+    uint64_t base_epoch_ = 0;
+    std::vector<Transition> transitions_;
+    simtime since_ = 0;
+    simtime unplanned_time_ = 0;
+    simtime paused_time_ = 0;
+};
+
+/**
+ * @brief What a node last saw of the state of its shift calendar.
+ */
+class CalendarView {
+public:
+    /** @brief The slot of a node that is not in a list of the calendar. */
+    static constexpr size_t INACTIVE = static_cast<size_t>(-1);
+
+    /**
+     * @brief Follows a calendar from its current state.
+     *
+     * @param calendar The calendar state, nullptr to follow none.
+     */
+    void attach(const CalendarState *calendar)
+    {
+        calendar_ = calendar;
+        if (!calendar)
+            return;
+        epoch_ = calendar->epoch();
+        mode_ = calendar->mode();
+    }
+
+    /**
+     * @returns True if the calendar changed mode since the node last caught up.
+     */
+    bool pending() const { return calendar_ && calendar_->epoch() != epoch_; }
+
+    /**
+     * @brief Catches up with the calendar.
+     *
+     * Every transition the node missed is passed to @p apply in time order,
+     * so the node can log its state up to the boundary and change mode as it
+     * would have at the boundary itself.
+     *
+     * @param apply Called with each CalendarState::Transition.
+     */
+    template <typename Apply>
+    void sync(Apply&& apply)
+    {
+        if (!pending())
+            return;
+        const CalendarState::Transition *transition = calendar_->transitions_since(epoch_);
+        const CalendarState::Transition *end = transition + (calendar_->epoch() - epoch_);
+        epoch_ = calendar_->epoch();
+        mode_ = calendar_->mode();
+        for (; transition != end; ++transition)
+            apply(*transition);
+    }
+
+    /**
+     * @returns The mode the node is in, including transitions it has not
+     * caught up with yet.
+     */
+    CalendarState::Mode mode() const { return calendar_ ? calendar_->mode() : mode_; }
+
+    /**
+     * @returns The mode the node last caught up to.
+     */
+    CalendarState::Mode synced_mode() const { return mode_; }
+
+    /**
+     * @returns The time of the first transition the node has not caught up
+     * with, the node's own statistics still count its last mode after it.
+     * The current time if there is none.
+     *
+     * @param now The current simulation time.
+     */
+    simtime pending_since(simtime now) const
+    {
+        return pending() ? calendar_->transitions_since(epoch_)->time : now;
+    }
+
+    /**
+     * @brief The time in a mode in the transitions the node has not caught
+     * up with yet, used by queries that must not change the node.
+     *
+     * @param mode The mode.
+     * @param now  The current simulation time.
+     *
+     * @returns The time in @p mode since the first missed transition.
+     */
+    simtime pending_time(CalendarState::Mode mode, simtime now) const
+    {
+        if (!pending())
+            return 0;
+        simtime total = 0;
+        const CalendarState::Transition *transition = calendar_->transitions_since(epoch_);
+        const CalendarState::Transition *end = transition + (calendar_->epoch() - epoch_);
+        for (; transition != end; ++transition) {
+            if (transition->to != mode)
+                continue;
+            simtime until = transition + 1 != end ? transition[1].time : now;
+            total += until - transition->time;
+        }
+        return total;
+    }
+
+    /**
+     * @returns The calendar state, or nullptr.
+     */
+    const CalendarState* calendar() const { return calendar_; }
+
+    /**
+     * @returns The position in the active nodes of the calendar, or INACTIVE.
+     */
+    size_t active_slot() const { return active_slot_; }
+    void set_active_slot(size_t slot) { active_slot_ = slot; }
+
+    /**
+     * @returns The position in the waiting nodes of the calendar, or INACTIVE.
+     */
+    size_t waiting_slot() const { return waiting_slot_; }
+    void set_waiting_slot(size_t slot) { waiting_slot_ = slot; }
+
+private:
+    const CalendarState *calendar_ = nullptr;
+    uint64_t epoch_ = 0;
+    CalendarState::Mode mode_ = CalendarState::WORKING;
+    size_t active_slot_ = INACTIVE;
+    size_t waiting_slot_ = INACTIVE;
+};
+
+} // namespace xsim
+
+#endif // CALENDARSTATE_H
@@ -0,0 +1,534 @@
+#ifndef CONVEYORTRACK_H
+#define CONVEYORTRACK_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common.h"
+
+namespace xsim {
+
+class Entity;
+
+/**
+ * @brief An event free model of the items on a conveyor.
+ *
+ * Positions are never stored, they are computed on demand from the distance
+ * the belt has moved. The belt distance grows with the speed while the belt
+ * runs, and a moving item is kept as the belt distance at which it entered,
+ * so its position is the current belt distance minus that offset.
+ *
+ * On an accumulating conveyor the items that have reached the end, or the
+ * items queued behind them, form a train of touching items. The train is
+ * kept as the position of its head and the prefix length of each item, so
+ * removing the head item moves the whole train without touching the other
+ * items. A released train moves at the belt speed until its head reaches the
+ * end again.
+ *
+ * The owner only schedules the next front arrival, the next time a moving
+ * item joins the train and the next time the entrance opens, all of which
+ * are computed analytically. Adding and removing items is O(log n) and
+ * advancing is O(1) per item that joins the train.
+ *
+ * Lengths and positions are the front of the items, in the length unit of
+ * the speed. An item enters with its front at zero and the entrance opens
+ * when its rear has left zero. Distances below the simulation tolerance are
+ * treated as zero. The belt distance is rebased to zero once it passes
+ * REBASE_DISTANCE, so positions keep their precision in long runs.
+ */
+class ConveyorTrack {
+public:
+    /** @brief Returned when something never happens with the current state. */
+    static constexpr simtime NEVER = std::numeric_limits<simtime>::infinity();
+
+    /** @brief The belt distance at which the offsets are rebased to zero. */
+    static constexpr double REBASE_DISTANCE = 1e6;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param length       The length of the conveyor.
+     * @param speed        The belt speed.
+     * @param accumulating True if items queue at the end instead of stopping the belt.
+     */
+    ConveyorTrack(double length = 0.0, double speed = 1.0, bool accumulating = true) :
+        length_(length),
+        speed_(speed),
+        accumulating_(accumulating),
+        running_(true),
+        belt_(0.0),
+        belt_time_(0.0),
+        sequence_(0),
+        train_head_(0.0),
+        train_belt_(0.0),
+        train_prefix_(0.0),
+        occupied_(0.0)
+    {}
+
+    /**
+     * @brief Removes all items and resets the belt, keeps the length, speed
+     * and accumulation.
+     *
+     * @param now The current simulation time.
+     */
+    void clear(simtime now)
+    {
+        moving_.clear();
+        train_.clear();
+        items_.clear();
+        belt_ = 0.0;
+        belt_time_ = now;
+        train_prefix_ = 0.0;
+        sequence_ = 0;
+        occupied_ = 0.0;
+    }
+
+    void set_length(double length) { length_ = length; }
+    double length() const { return length_; }
+
+    void set_accumulating(bool accumulating) { accumulating_ = accumulating; }
+    bool accumulating() const { return accumulating_; }
+
+    /**
+     * @brief Sets the belt speed.
+     *
+     * @param speed The speed.
+     * @param now   The current simulation time.
+     */
+    void set_speed(double speed, simtime now)
+    {
+        anchor(now);
+        speed_ = speed;
+    }
+
+    double speed() const { return speed_; }
+
+    /**
+     * @brief Starts the belt after a stop, a failure or a pause.
+     *
+     * @param now The current simulation time.
+     */
+    void start(simtime now)
+    {
+        anchor(now);
+        running_ = true;
+    }
+
+    /**
+     * @brief Stops the belt, no item moves until it is started.
+     *
+     * @param now The current simulation time.
+     */
+    void stop(simtime now)
+    {
+        anchor(now);
+        running_ = false;
+    }
+
+    bool running() const { return running_; }
+
+    /**
+     * @returns The number of items on the conveyor.
+     */
+    size_t size() const { return items_.size(); }
+
+    bool empty() const { return items_.empty(); }
+
+    /**
+     * @returns The total length of the items on the conveyor.
+     */
+    double occupied_length() const { return occupied_; }
+
+    /**
+     * @brief Adds an item at the entrance.
+     *
+     * @param entity The entity.
+     * @param length The length of the entity along the conveyor.
+     * @param now    The current simulation time.
+     */
+    void push(Entity *entity, double length, simtime now)
+    {
+        if (belt(now) >= REBASE_DISTANCE)
+            rebase(now);
+        add_moving(entity, length, belt(now));
+        occupied_ += length;
+    }
+
+    /**
+     * @brief Moves the items that have caught up with the train into it,
+     * must be called before the state is read at a new time.
+     *
+     * @param now The current simulation time.
+     *
+     * @returns The number of items that joined the train.
+     */
+    size_t advance(simtime now)
+    {
+        size_t joined = 0;
+        double distance = belt(now);
+        while (!moving_.empty()) {
+            auto first = moving_.begin();
+            double position = distance - first->first.offset;
+            double limit = train_.empty() ? length_ : train_tail(distance);
+            if (!accumulating_ && train_.empty())
+                break;
+            if (position + tolerance < limit)
+                break;
+            join_train(first, limit, distance);
+            ++joined;
+        }
+        return joined;
+    }
+
+    /**
+     * @returns The item at the front, or nullptr if the conveyor is empty.
+     */
+    Entity* front() const
+    {
+        if (!train_.empty())
+            return train_.front().entity;
+        return moving_.empty() ? nullptr : moving_.begin()->second.entity;
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns True if the front item has reached the end.
+     */
+    bool front_arrived(simtime now) const
+    {
+        return next_front_arrival(now) <= now;
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns The time the front item reaches the end, NEVER if the belt is stopped.
+     */
+    simtime next_front_arrival(simtime now) const
+    {
+        double distance = belt(now);
+        double remaining;
+        if (!train_.empty())
+            remaining = length_ - train_head(distance);
+        else if (!moving_.empty())
+            remaining = length_ - (distance - moving_.begin()->first.offset);
+        else
+            return NEVER;
+        return time_to_cover(remaining, now);
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns The time the first moving item reaches the tail of a stopped
+     *          train, NEVER if it does not happen with the current state.
+     */
+    simtime next_accumulation(simtime now) const
+    {
+        if (!accumulating_ || moving_.empty() || train_.empty())
+            return NEVER;
+        double distance = belt(now);
+        if (train_head(distance) + tolerance < length_)
+            return NEVER; // A moving train keeps its distance to the items behind.
+        double position = distance - moving_.begin()->first.offset;
+        return time_to_cover(train_tail(distance) - position, now);
+    }
+
+    /**
+     * @param now The current simulation time.
+     *
+     * @returns The time the entrance opens for the next item, NEVER if it is
+     *          blocked by the train.
+     */
+    simtime next_open(simtime now) const
+    {
+        double distance = belt(now);
+        if (!moving_.empty()) {
+            const auto& last = *moving_.rbegin();
+            return time_to_cover(last.second.length - (distance - last.first.offset), now);
+        }
+        if (train_.empty())
+            return now;
+        const TrainItem& last = train_.back();
+        double rear = train_head(distance) - (last.prefix - train_.front().prefix) - last.length;
+        if (rear + tolerance >= 0.0)
+            return now;
+        if (train_head(distance) + tolerance >= length_)
+            return NEVER;
+        return time_to_cover(-rear, now);
+    }
+
+    /**
+     * @brief Removes the front item, which must have arrived. The rest of
+     * the train is released and follows at the belt speed.
+     *
+     * @param now The current simulation time.
+     *
+     * @returns The removed entity.
+     */
+    Entity* pop_front(simtime now)
+    {
+        advance(now);
+        Entity *entity = front();
+        if (entity)
+            erase(entity, now);
+        return entity;
+    }
+
+    /**
+     * @brief Removes an item anywhere on the conveyor.
+     *
+     * @param entity The entity.
+     * @param now    The current simulation time.
+     *
+     * @returns True if the entity was on the conveyor.
+     */
+    bool erase(Entity *entity, simtime now)
+    {
+        auto it = items_.find(entity);
+        if (it == items_.end())
+            return false;
+        double distance = belt(now);
+        if (!it->second.in_train) {
+            auto moving = moving_.find(it->second.key);
+            occupied_ -= moving->second.length;
+            moving_.erase(moving);
+        } else if (train_.front().entity == entity) {
+            // The train behind the removed head is released from where it stands.
+            double head = train_head(distance);
+            double length = train_.front().length;
+            occupied_ -= length;
+            train_.pop_front();
+            train_head_ = head - length;
+            train_belt_ = distance;
+        } else {
+            // Removing from the middle of a train releases the items behind it,
+            // which become moving items again.
+            double head = train_head(distance);
+            double base = train_.front().prefix;
+            size_t i = 0;
+            while (train_[i].entity != entity)
+                ++i;
+            occupied_ -= train_[i].length;
+            for (size_t j = i + 1; j < train_.size(); ++j) {
+                double position = head - (train_[j].prefix - base);
+                add_moving(train_[j].entity, train_[j].length, distance - position);
+            }
+            // The next item to join the train continues from the removed one.
+            train_prefix_ = train_[i].prefix;
+            train_.erase(train_.begin() + i, train_.end());
+        }
+        items_.erase(entity);
+        return true;
+    }
+
+    /**
+     * @param entity The entity.
+     * @param now    The current simulation time.
+     *
+     * @returns The position of the front of the entity, or a negative value
+     *          if it is not on the conveyor.
+     */
+    double position(const Entity *entity, simtime now) const
+    {
+        auto it = items_.find(entity);
+        if (it == items_.end())
+            return -1.0;
+        double distance = belt(now);
+        if (!it->second.in_train)
+            return std::min(distance - it->second.key.offset, limit_for(it->second.key, distance));
+        for (const TrainItem& item : train_)
+            if (item.entity == entity)
+                return train_head(distance) - (item.prefix - train_.front().prefix);
+        return -1.0;
+    }
+
+    /**
+     * @brief Get the position of every item, front first, for animation.
+     *
+     * @param now       The current simulation time.
+     * @param positions Receives the entities and the position of their fronts.
+     */
+    void positions(simtime now, std::vector<std::pair<Entity*, double>>& positions) const
+    {
+        positions.clear();
+        double distance = belt(now);
+        double limit = length_;
+        if (!train_.empty()) {
+            double head = train_head(distance);
+            for (const TrainItem& item : train_)
+                positions.emplace_back(item.entity, head - (item.prefix - train_.front().prefix));
+            limit = train_tail(distance);
+        }
+        for (const auto& [key, item] : moving_) {
+            double position = std::min(distance - key.offset, limit);
+            positions.emplace_back(item.entity, position);
+            limit = position - item.length;
+        }
+    }
+
+private:
+    struct Moving {
+        Entity *entity;
+        double length;
+    };
+
+    /**
+     * @brief The key of a moving item, items that entered at the same belt
+     * distance while the belt was stopped are ordered by when they entered.
+     */
+    struct MovingKey {
+        double offset;
+        uint64_t sequence;
+
+        bool operator<(const MovingKey& other) const
+        {
+            return offset < other.offset || (offset == other.offset && sequence < other.sequence);
+        }
+
+        bool operator==(const MovingKey& other) const
+        {
+            return offset == other.offset && sequence == other.sequence;
+        }
+    };
+
+    struct TrainItem {
+        Entity *entity;
+        double length;
+        /** @brief The total length of the items that joined the train before. */
+        double prefix;
+    };
+
+    struct Location {
+        bool in_train;
+        /** @brief The key of a moving item. */
+        MovingKey key;
+    };
+
+    double belt(simtime now) const
+    {
+        return running_ ? belt_ + speed_ * (now - belt_time_) : belt_;
+    }
+
+    void anchor(simtime now)
+    {
+        belt_ = belt(now);
+        belt_time_ = now;
+    }
+
+    /**
+     * @brief Moves the belt distance back to zero, shifting the offsets of
+     * the moving items and the train by the same amount.
+     */
+    void rebase(simtime now)
+    {
+        anchor(now);
+        double shift = belt_;
+        belt_ = 0.0;
+        train_belt_ -= shift;
+        std::map<MovingKey, Moving> moving;
+        for (auto& [key, item] : moving_) {
+            MovingKey shifted{ key.offset - shift, key.sequence };
+            moving.emplace_hint(moving.end(), shifted, item);
+            items_[item.entity].key = shifted;
+        }
+        moving_.swap(moving);
+    }
+
+    void add_moving(Entity *entity, double length, double offset)
+    {
+        MovingKey key{ offset, sequence_++ };
+        moving_.emplace(key, Moving{ entity, length });
+        items_[entity] = Location{ false, key };
+    }
+
+    simtime time_to_cover(double distance, simtime now) const
+    {
+        if (distance <= tolerance)
+            return now;
+        if (!running_ || speed_ <= 0.0)
+            return NEVER;
+        return now + distance / speed_;
+    }
+
+    /**
+     * @returns The position of the head of the train, a released train moves
+     *          with the belt until it reaches the end.
+     */
+    double train_head(double distance) const
+    {
+        return std::min(train_head_ + (distance - train_belt_), length_);
+    }
+
+    double train_tail(double distance) const
+    {
+        const TrainItem& last = train_.back();
+        return train_head(distance) - (last.prefix - train_.front().prefix) - last.length;
+    }
+
+    /**
+     * @returns The furthest position a moving item can have.
+     */
+    double limit_for(const MovingKey& key, double distance) const
+    {
+        if (moving_.empty() || !(moving_.begin()->first == key))
+            return NEVER;
+        return train_.empty() ? length_ : train_tail(distance);
+    }
+
+    void join_train(std::map<MovingKey, Moving>::iterator it, double position, double distance)
+    {
+        if (train_.empty()) {
+            train_head_ = position;
+            train_belt_ = distance;
+            train_prefix_ = 0.0;
+        }
+        train_.push_back(TrainItem{ it->second.entity, it->second.length, train_prefix_ });
+        train_prefix_ += it->second.length;
+        items_[it->second.entity] = Location{ true, MovingKey{ 0.0, 0 } };
+        moving_.erase(it);
+    }
+
+    double length_;
+    double speed_;
+    bool accumulating_;
+    bool running_;
+
+    /** @brief The belt distance at belt_time_. */
+    double belt_;
+    simtime belt_time_;
+
+    /** @brief Moving items by the belt distance at which they entered, front first. */
+    std::map<MovingKey, Moving> moving_;
+
+    /** @brief Orders moving items that entered at the same belt distance. */
+    uint64_t sequence_;
+
+    /** @brief The train of touching items at the end, head first. */
+    std::deque<TrainItem> train_;
+
+    /** @brief The position of the train head at belt distance train_belt_. */
+    double train_head_;
+    double train_belt_;
+
+    /** @brief The prefix of the next item to join the train. */
+    double train_prefix_;
+
+    /** @brief Where each entity is. */
+    std::unordered_map<const Entity*, Location> items_;
+
+    double occupied_;
+};
+
+} // namespace xsim
+
+#endif // CONVEYORTRACK_H
@@ -1,35 +1,90 @@
-#ifndef DISPATCH_H
-#define DISPATCH_H
-
-#include <xsim_config>
-#include <list>
-
-#include "object.h"
-
-namespace xsim {
-
-class Entity;
-class Node;
-
-/**
- * @brief Base class for sorting the block list in an arbitrary order.
- */
-class XSIM_EXPORT Dispatch : public Object {
- public:
-     /**
-      * @brief Destructor
-      */
-     virtual ~Dispatch() {}
-    
-     /**
-      * @brief Sort the block list in some arbitrary order.
-      *
-      * @param node The node that owns the block list.
-      * @param block_list The block list that will have the new order.
-      */
-     virtual void sort(Node *node, std::list<Entity*> *block_list) = 0;
-};
-
-} // namespace xsim
-
-#endif // DISPATCH_H
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include <xsim_config>
+#include <list>
+
+#include "object.h"
+
+namespace xsim {
+
+class Entity;
+class Node;
+class Variant;
+
+/**
+ * @brief Base class for sorting the block list in an arbitrary order.
+ */
+class XSIM_EXPORT Dispatch : public Object {
+ public:
+     /**
+      * @brief Destructor
+      */
+     virtual ~Dispatch() {}
+    
+     /**
+      * @brief Sort the block list in some arbitrary order.
+      *
+      * @param node The node that owns the block list.
+      * @param block_list The block list that will have the new order.
+      */
+     virtual void sort(Node *node, std::list<Entity*> *block_list) = 0;
+
+     /**
+      * @brief Events that change the keys of entities already in the dispatch queue.
+      */
+     enum Invalidation {
+         /** @brief The key of an entity never changes while it is blocked. */
+         INVALIDATED_BY_NOTHING = 0,
+         /** @brief The keys depend on the last entity that entered the node. */
+         INVALIDATED_BY_LAST_ENTITY = 1 << 0,
+         /** @brief The keys depend on order priorities. */
+         INVALIDATED_BY_ORDER = 1 << 1
+     };
+
+     /**
+      * @brief Check if the dispatcher orders entities by a key.
+      *
+      * Keyed dispatchers are kept in an incremental dispatch queue by the
+      * enter port, other dispatchers have the block list re-sorted with sort().
+      *
+      * @return True if key() is implemented.
+      */
+     virtual bool has_key() const { return false; }
+
+     /**
+      * @brief Get the dispatch key of a blocked entity, lower keys are
+      * dispatched first and equal keys in block order.
+      *
+      * @param node The node that owns the block list.
+      * @param entity The blocked entity.
+      *
+      * @return The key.
+      */
+     virtual double key(Node * /*node*/, Entity * /*entity*/) { return 0.0; }
+
+     /**
+      * @brief Get the key group of a blocked entity. Entities in the same
+      * group always have equal keys, so the enter port keeps only the first
+      * entity of each group in its dispatch queue and recomputes one key per
+      * group, not per entity, when the keys are invalidated.
+      *
+      * @param entity The blocked entity.
+      *
+      * @return The variant that determines the key, or null if the key is
+      * computed per entity.
+      */
+     virtual Variant* key_group(Entity * /*entity*/) const { return nullptr; }
+
+     /**
+      * @brief Get the events that change the keys of blocked entities, the
+      * enter port recomputes all keys when one of them occurs.
+      *
+      * @return A combination of Invalidation flags.
+      */
+     virtual unsigned int invalidated_by() const { return INVALIDATED_BY_NOTHING; }
+};
+
+} // namespace xsim
+
+#endif // DISPATCH_H
@@ -1,41 +1,46 @@
-#ifndef DISPATCHSPT_H
-#define DISPATCHSPT_H
-
-#include <xsim_config>
-#include <list>
-
-#include "dispatch.h"
-
-namespace xsim {
-
-class Node;
-class Entity;
-
-/**
- * @brief Sort the block list in shortest processing time order.
- */
-class XSIM_EXPORT DispatchSpt : public Dispatch {
- public:
-     /** @brief Default constructor */
-     DispatchSpt();
-
-     /* Documented in distpatch.h */
-     void sort(Node *node, std::list<Entity*> *block_list) override;
-
- private:
-     /**
-      * @brief Helper class for sorting
-      */
-     class SptSorter {
-      public:
-          SptSorter(Node *node) : node_(node) {}
-          bool operator() (const Entity *mu1,
-                  const Entity *mu2) const;
-      private:
-          Node *node_;
-     };
-};
-
-} // namespace xsim
-
-#endif // DISPATCHSPT_H
+#ifndef DISPATCHSPT_H
+#define DISPATCHSPT_H
+
+#include <xsim_config>
+#include <list>
+
+#include "dispatch.h"
+
+namespace xsim {
+
+class Node;
+class Entity;
+
+/**
+ * @brief Sort the block list in shortest processing time order.
+ */
+class XSIM_EXPORT DispatchSpt : public Dispatch {
+ public:
+     /** @brief Default constructor */
+     DispatchSpt();
+
+     /* Documented in distpatch.h */
+     void sort(Node *node, std::list<Entity*> *block_list) override;
+
+     /* Documented in dispatch.h */
+     bool has_key() const override { return true; }
+     double key(Node *node, Entity *entity) override;
+     unsigned int invalidated_by() const override { return INVALIDATED_BY_NOTHING; }
+
+ private:
+     /**
+      * @brief Helper class for sorting
+      */
+     class SptSorter {
+      public:
+          SptSorter(Node *node) : node_(node) {}
+          bool operator() (const Entity *mu1,
+                  const Entity *mu2) const;
+      private:
+          Node *node_;
+     };
+};
+
+} // namespace xsim
+
+#endif // DISPATCHSPT_H
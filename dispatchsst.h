@@ -1,41 +1,71 @@
-#ifndef DISPATCHSST_H
-#define DISPATCHSST_H
-
-#include <xsim_config>
-#include <list>
-
-#include "dispatch.h"
-
-namespace xsim {
-
-class Node;
-class Entity;
-
-/**
- * @brief Sort block list in shortest setup time order.
- */
-class XSIM_EXPORT DispatchSst : public Dispatch {
- public:
-     /** @brief Default constructor */
-     DispatchSst();
-
-     /* Documented in dispatch.h */
-     void sort(Node *node, std::list<Entity*> *block_list) override;
-
- private:
-     /**
-      * @brief Helper class for sorting.
-      */
-     class SstSorter {
-      public:
-          SstSorter(Node *node) : node_(node) {}
-          bool operator() (const Entity *mu1,
-                  const Entity *mu2) const;
-      private:
-          Node *node_;
-     };
-};
-
-} // namespace xsim
-
-#endif // DISPATCHSST_H
+#ifndef DISPATCHSST_H
+#define DISPATCHSST_H
+
+#include <xsim_config>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "dispatch.h"
+
+namespace xsim {
+
+class Node;
+class Entity;
+class SetupTable;
+class Variant;
+
+/**
+ * @brief Sort block list in shortest setup time order.
+ */
+class XSIM_EXPORT DispatchSst : public Dispatch {
+ public:
+     /** @brief Default constructor */
+     DispatchSst();
+
+     /* Documented in dispatch.h */
+     void sort(Node *node, std::list<Entity*> *block_list) override;
+
+     /* Documented in dispatch.h */
+     bool has_key() const override { return true; }
+     double key(Node *node, Entity *entity) override;
+     unsigned int invalidated_by() const override { return INVALIDATED_BY_LAST_ENTITY; }
+
+     /**
+      * @brief The setup time only depends on the variant used for setup, so
+      * entities are grouped by it and a new last entity recomputes one key
+      * per blocked variant.
+      */
+     Variant* key_group(Entity *entity) const override;
+
+ private:
+     /**
+      * @brief Sorts the block list by the setup times gathered from the
+      * setup matrix of the node, one row read for all blocked entities.
+      *
+      * @param node The node that owns the block list.
+      * @param setup_table The setup table of the node.
+      * @param block_list The block list that will have the new order.
+      */
+     void sort_by_matrix(Node *node, SetupTable *setup_table, std::list<Entity*> *block_list);
+
+     /** @brief Scratch buffers reused between calls to sort_by_matrix. */
+     std::vector<uint32_t> indices_;
+     std::vector<double> times_;
+
+     /**
+      * @brief Helper class for sorting, used when the node has no setup table.
+      */
+     class SstSorter {
+      public:
+          SstSorter(Node *node) : node_(node) {}
+          bool operator() (const Entity *mu1,
+                  const Entity *mu2) const;
+      private:
+          Node *node_;
+     };
+};
+
+} // namespace xsim
+
+#endif // DISPATCHSST_H
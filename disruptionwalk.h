@@ -0,0 +1,179 @@
+#ifndef DISRUPTIONWALK_H
+#define DISRUPTIONWALK_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace xsim {
+
+class DisruptionWalkPool;
+class Failure;
+class Node;
+
+/**
+ * @brief The propagation of a disruption begin or end through the nodes.
+ *
+ * Replaces the recursion with a map of visited nodes. Each walk gets a new
+ * epoch and a node that is reached stamps itself with it, see
+ * Node::visit_disruption, so checking and marking a node is a compare and
+ * a store. The nodes to propagate to are pushed on a worklist that is
+ * processed by Node::propagate_disruption_begin/end. The nodes pushed by one
+ * node are taken in the order they were pushed and before the nodes pushed
+ * earlier, so the nodes are disrupted in the same depth first order as the
+ * recursion did. Worklists are reused between walks through the pool of the
+ * simulation, and a walk started while another is in progress takes its
+ * own, so propagation does not allocate once the model has warmed up.
+ *
+ * A node holds a single stamp, so only the outermost walk uses it. A walk
+ * started while another is in progress, by a disruption that begins or ends
+ * a failure of its own, keeps the nodes it reached in a set instead and
+ * leaves the stamps of the outer walk alone. Nested walks are rare, only
+ * they allocate.
+ */
+class DisruptionWalk {
+public:
+    /** @brief A node to propagate to and the level it is reached at. */
+    struct Step {
+        Node *node;
+        int level;
+    };
+
+    /**
+     * @param pool      The pool of the simulation, see Simulation::disruption_walks.
+     * @param failure   The failure that is propagated.
+     * @param propagate False to only disrupt the node of the failure.
+     */
+    DisruptionWalk(DisruptionWalkPool& pool, Failure *failure, bool propagate);
+
+    ~DisruptionWalk();
+
+    /** Copying and moving walks is not supported. */
+    DisruptionWalk(const DisruptionWalk&) = delete;
+    DisruptionWalk& operator=(const DisruptionWalk&) = delete;
+
+    /**
+     * @returns The epoch that nodes reached by this walk are stamped with.
+     */
+    uint64_t epoch() const { return epoch_; }
+
+    /**
+     * @returns True if the walk was started while another was in progress.
+     */
+    bool nested() const { return nested_; }
+
+    /**
+     * @brief Marks a node as reached by this walk.
+     *
+     * @param node  The node.
+     * @param stamp The epoch stamp of the node, only used by the outermost walk.
+     *
+     * @returns False if the walk already reached the node.
+     */
+    bool visit(const Node *node, uint64_t& stamp)
+    {
+        if (nested_)
+            return visited_.insert(node).second;
+        if (stamp == epoch_)
+            return false;
+        stamp = epoch_;
+        return true;
+    }
+
+    /**
+     * @returns The failure that is propagated.
+     */
+    Failure* failure() const { return failure_; }
+
+    /**
+     * @returns True if the disruption propagates beyond the node of the failure.
+     */
+    bool propagate() const { return propagate_; }
+
+    /**
+     * @brief Adds a node to propagate to.
+     *
+     * @param node  The node.
+     * @param level The level the node is reached at.
+     */
+    void push(Node *node, int level) { worklist_.push_back(Step{ node, level }); }
+
+    /**
+     * @brief Takes the next node to propagate to.
+     *
+     * @param step Receives the node and its level.
+     *
+     * @returns False if the worklist is empty.
+     */
+    bool pop(Step& step)
+    {
+        std::reverse(worklist_.begin() + pushed_from_, worklist_.end());
+        if (worklist_.empty())
+            return false;
+        step = worklist_.back();
+        worklist_.pop_back();
+        pushed_from_ = worklist_.size();
+        return true;
+    }
+
+private:
+    DisruptionWalkPool& pool_;
+    Failure *failure_;
+    bool propagate_;
+    uint64_t epoch_;
+    bool nested_;
+    /** @brief The nodes reached by a nested walk, see visit(). */
+    std::unordered_set<const Node*> visited_;
+    std::vector<Step> worklist_;
+    /** @brief The size of the worklist at the last pop, the nodes after it are still in push order. */
+    size_t pushed_from_ = 0;
+};
+
+/**
+ * @brief The epoch counter and the recycled worklists of the disruption
+ * walks of a simulation, owned by Simulation.
+ */
+class DisruptionWalkPool {
+public:
+    DisruptionWalkPool() = default;
+
+    /** Copying and moving the pool is not supported. */
+    DisruptionWalkPool(const DisruptionWalkPool&) = delete;
+    DisruptionWalkPool& operator=(const DisruptionWalkPool&) = delete;
+
+private:
+    friend class DisruptionWalk;
+
+    uint64_t epoch_counter_ = 0;
+    /** @brief The number of walks in progress. */
+    size_t active_ = 0;
+    std::vector<std::vector<DisruptionWalk::Step>> spare_;
+};
+
+inline DisruptionWalk::DisruptionWalk(DisruptionWalkPool& pool, Failure *failure, bool propagate) :
+    pool_(pool),
+    failure_(failure),
+    propagate_(propagate),
+    epoch_(++pool.epoch_counter_),
+    nested_(pool.active_++ > 0)
+{
+    if (!pool_.spare_.empty()) {
+        worklist_ = std::move(pool_.spare_.back());
+        pool_.spare_.pop_back();
+    }
+}
+
+inline DisruptionWalk::~DisruptionWalk()
+{
+    --pool_.active_;
+    worklist_.clear();
+    pool_.spare_.push_back(std::move(worklist_));
+}
+
+} // namespace xsim
+
+#endif // DISRUPTIONWALK_H
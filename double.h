@@ -1,38 +1,64 @@
-﻿#ifndef DOUBLE_H
-#define DOUBLE_H
-
-#include <xsim_config>
-#include <list>
-#include <string>
-
-namespace mu {
-class Parser;
-}
-
-namespace xsim {
-
-class Simulation;
-
-class XSIM_EXPORT Double {
-public:
-    Double();
-    Double(double value);
-    Double(const std::string& value);
-    Double(const Double& d);
-    ~Double();
-    Double& operator=(const Double& rhs);
-    operator double() const;
-
-    double value() const;
-    std::string to_string() const;
-    mu::Parser* parser() const;
-
-private:
-    mu::Parser* parser_;
-    double value_;
-    std::string value_string_;
-};
-
-} // namespace xsim
-
-#endif // DOUBLE_H
+﻿#ifndef DOUBLE_H
+#define DOUBLE_H
+
+#include <xsim_config>
+#include <list>
+#include <string>
+
+namespace mu {
+class Parser;
+}
+
+namespace xsim {
+
+class Expression;
+class Simulation;
+
+/**
+ * @brief A double parameter that is either a constant or an expression.
+ *
+ * Expressions are compiled by the simulation ExpressionCompiler and shared
+ * between all parameters with the same expression string. The value is
+ * cached and re-evaluated by the compiler when a variable it reads changes.
+ */
+class XSIM_EXPORT Double {
+public:
+    Double();
+    Double(double value);
+    Double(const std::string& value);
+    Double(const Double& d);
+    ~Double();
+    Double& operator=(const Double& rhs);
+    operator double() const;
+
+    double value() const;
+    std::string to_string() const;
+
+    /**
+     * @return The compiled expression, or nullptr if the value is a constant.
+     */
+    const Expression* expression() const;
+
+    /**
+     * @brief Kept so that code written against the per-parameter muParser
+     * parsers still compiles.
+     *
+     * Expressions are compiled by the ExpressionCompiler and no parser is
+     * created any more, so this always returns nullptr. Use expression().
+     *
+     * @return nullptr.
+     */
+    [[deprecated("use expression()")]]
+    mu::Parser* parser() const { return nullptr; }
+
+private:
+    /** @brief The compiled expression, owned by the ExpressionCompiler. */
+    Expression* expression_;
+
+    /** @brief The value used when there is no expression. */
+    double value_;
+};
+
+} // namespace xsim
+
+#endif // DOUBLE_H
@@ -1,167 +1,224 @@
-#ifndef ENTERLOGIC_H
-#define ENTERLOGIC_H
-
-#include <xsim_config>
-#include <string>
-#include <list>
-
-#include "logic.h"
-
-namespace xsim {
-
-class Node;
-class Entity;
-class Simulation;
-
-class BlockItem {
-public:
-    Node *node;
-    Entity *entity;
-    simtime time;
-    unsigned int sequence;
-    int sucessor_order;
-    int exits;
-};
-
-struct BlockItemSorter {
-    bool operator() (const BlockItem *item1, const BlockItem *item2) const
-    {
-        if (item1->time < item2->time)
-            return true;
-        else if (item1->time == item2->time &&
-                item1->sucessor_order < item2->sucessor_order)
-            return true;
-        else if (item1->time == item2->time &&
-                item1->sucessor_order == item2->sucessor_order &&
-                item1->sequence < item2->sequence)
-            return true;
-
-        return false;
-    }
-};
-
-/**
- * @brief Determine if a block item has a particular entity.
- */
-class SameEntity {
- public:
-     /**
-      * @brief Constructor.
-      *
-      * @param entity The entity to to compare against.
-      */
-     SameEntity(Entity *entity) { entity_ = entity; }
-
-     /**
-      * @brief Check if a block items entity matches the entity.
-      *
-      * @param item The block item.
-      *
-      * @return True if it matches.
-      */
-     bool operator() (const BlockItem *item) { return item->entity == entity_; }
- private:
-     /**
-      * @brief The entity that should be compared against block items.
-      */
-     Entity *entity_;
-};
-
-/**
- * @brief Base class for logics that want to prevent entity from entering
- * nodes.
- */
-class XSIM_EXPORT EnterLogic : public virtual Logic {
- public:
-     /**
-      * @brief Constructor.
-      */
-     EnterLogic();
-
-     ~EnterLogic();
-
-     void init() override;
-     void reset_stats() override;
-     void finalize() override;
-
-     /**
-      * @brief Check if a entity are allowed to enter a node.
-      *
-      * @param node The node the entity wants to enter on.
-      * @param entity The entity that wants to enter.
-      *
-      * @return True if it is allowed to enter.
-      */
-     virtual bool allow_enter(Node *node, Entity *entity) = 0;
-
-     /**
-      * @brief Add a entity to the forward blocking list.
-      *
-      * @param node The node the entity wanted to enter.
-      * @param entity The entity that was blocked.
-      */
-     virtual void add_forward_blocking(Node *node, Entity *entity);
-
-     /**
-      * @brief Remove a entity from the forward blocking list.
-      *
-      * @param iterator The iterator to the entity on the block list.
-      */
-     virtual void remove_forward_blocking(
-            const std::list<BlockItem*>::iterator &iterator);
-
- protected:
-     typedef std::list<BlockItem*> BlockList;
-     typedef BlockList::const_iterator BlockListIterator;
-
-     /**
-      * @brief Check if any forward blocked entity can now move.
-      *
-      * @param allow_move_to_all_succssors If true all successors are tried,
-      * not only the original destination.
-      */
-     void check_forward_blocking(bool allow_move_to_all_successors = false);
-
-     /**
-      * @brief Check if the sorted block list is valid.
-      *
-      * @return True if the block list is still valid.
-      */
-     bool is_sorted_block_list_valid() const;
-
-     /**
-      * @brief All entities that have been blocked.
-      */
-     BlockList block_list_;
-
-     /**
-      * @brief A list of all free block items.
-      */
-     BlockList free_block_list_;
-
-     /**
-      * @brief Used to determine the block list order of entities.
-      */
-     unsigned int sequence_;
-
- private:
-     /**
-      * @brief Used for invalidating the sorted block list.
-      */
-     bool is_sorted_block_list_valid_;
-
-     /**
-      * @brief A sorted version of the block list. It contains only one item for
-      * each destination.
-      */
-     BlockList sorted_block_list_;
-
-     /**
-      * @brief Used to sort the block list.
-      */
-     BlockItemSorter sorter_;
-};
-
-} // namespace xsim
-
-#endif // ENTERLOGIC_H
+#ifndef ENTERLOGIC_H
+#define ENTERLOGIC_H
+
+#include <xsim_config>
+#include <string>
+#include <list>
+#include <map>
+#include <set>
+
+#include "logic.h"
+
+namespace xsim {
+
+class Node;
+class Entity;
+class Simulation;
+
+class BlockItem {
+public:
+    Node *node;
+    Entity *entity;
+    simtime time;
+    unsigned int sequence;
+    int sucessor_order;
+    int exits;
+    /** @brief Unique and increasing in the order items are added to a block list. */
+    uint64_t insertion;
+};
+
+struct BlockItemSorter {
+    bool operator() (const BlockItem *item1, const BlockItem *item2) const
+    {
+        if (item1->time < item2->time)
+            return true;
+        else if (item1->time == item2->time &&
+                item1->sucessor_order < item2->sucessor_order)
+            return true;
+        else if (item1->time == item2->time &&
+                item1->sucessor_order == item2->sucessor_order &&
+                item1->sequence < item2->sequence)
+            return true;
+
+        return false;
+    }
+};
+
+/**
+ * @brief The block order with the insertion order as the last tiebreak, so
+ * that items that BlockItemSorter finds equivalent are all kept in an ordered
+ * set, in the same order on every run.
+ */
+struct BlockItemOrder {
+    bool operator() (const BlockItem *item1, const BlockItem *item2) const
+    {
+        BlockItemSorter sorter;
+        if (sorter(item1, item2))
+            return true;
+        if (sorter(item2, item1))
+            return false;
+        return item1->insertion < item2->insertion;
+    }
+};
+
+/**
+ * @brief Determine if a block item has a particular entity.
+ */
+class SameEntity {
+ public:
+     /**
+      * @brief Constructor.
+      *
+      * @param entity The entity to to compare against.
+      */
+     SameEntity(Entity *entity) { entity_ = entity; }
+
+     /**
+      * @brief Check if a block items entity matches the entity.
+      *
+      * @param item The block item.
+      *
+      * @return True if it matches.
+      */
+     bool operator() (const BlockItem *item) { return item->entity == entity_; }
+ private:
+     /**
+      * @brief The entity that should be compared against block items.
+      */
+     Entity *entity_;
+};
+
+/**
+ * @brief Base class for logics that want to prevent entity from entering
+ * nodes.
+ */
+class XSIM_EXPORT EnterLogic : public virtual Logic {
+ public:
+     /**
+      * @brief Constructor.
+      */
+     EnterLogic();
+
+     ~EnterLogic();
+
+     void init() override;
+     void reset_stats() override;
+     void finalize() override;
+
+     /**
+      * @brief Check if a entity are allowed to enter a node.
+      *
+      * @param node The node the entity wants to enter on.
+      * @param entity The entity that wants to enter.
+      *
+      * @return True if it is allowed to enter.
+      */
+     virtual bool allow_enter(Node *node, Entity *entity) = 0;
+
+     /**
+      * @brief Add a entity to the forward blocking list.
+      *
+      * @param node The node the entity wanted to enter.
+      * @param entity The entity that was blocked.
+      */
+     virtual void add_forward_blocking(Node *node, Entity *entity);
+
+     /**
+      * @brief Remove a entity from the forward blocking list.
+      *
+      * @param iterator The iterator to the entity on the block list.
+      */
+     virtual void remove_forward_blocking(
+            const std::list<BlockItem*>::iterator &iterator);
+
+ protected:
+     typedef std::list<BlockItem*> BlockList;
+     typedef BlockList::const_iterator BlockListIterator;
+
+     /**
+      * @brief Check if any forward blocked entity can now move.
+      *
+      * Only wakes the entities subscribed to this logic in
+      * Simulation::wakeup_index(), entities blocked on other conditions at
+      * the same destinations are left alone.
+      *
+      * @param allow_move_to_all_succssors If true all successors are tried,
+      * not only the original destination.
+      */
+     void check_forward_blocking(bool allow_move_to_all_successors = false);
+
+     /**
+      * @brief Check if the sorted block list is valid.
+      *
+      * The sorted block list is kept up to date as entities are blocked and
+      * unblocked, it is invalidated when it changes so that an iteration over
+      * it can restart.
+      *
+      * @return True if the block list has not changed since the last check.
+      */
+     bool is_sorted_block_list_valid() const;
+
+     /**
+      * @brief All entities that have been blocked.
+      */
+     BlockList block_list_;
+
+     /**
+      * @brief A list of all free block items.
+      */
+     BlockList free_block_list_;
+
+     /**
+      * @brief Used to determine the block list order of entities.
+      */
+     unsigned int sequence_;
+
+ private:
+     /**
+      * @brief Used for invalidating the sorted block list.
+      */
+     bool is_sorted_block_list_valid_;
+
+     /**
+      * @brief The number of items added to the block list, gives
+      * BlockItem::insertion.
+      */
+     uint64_t insertions_;
+
+     typedef std::set<BlockItem*, BlockItemOrder> OrderedBlockList;
+
+     /**
+      * @brief Add a block item to the sorted block lists.
+      *
+      * @param item The block item.
+      */
+     void insert_sorted(BlockItem *item);
+
+     /**
+      * @brief Remove a block item from the sorted block lists.
+      *
+      * @param item The block item.
+      */
+     void erase_sorted(BlockItem *item);
+
+     /**
+      * @brief The block items of each destination in block order.
+      */
+     std::map<Node*, OrderedBlockList> destination_block_lists_;
+
+     /**
+      * @brief A sorted version of the block list. It contains only one item for
+      * each destination, the first of destination_block_lists_, and is updated
+      * incrementally instead of being re-sorted.
+      */
+     OrderedBlockList sorted_block_list_;
+
+     /**
+      * @brief Used to sort the block list.
+      */
+     BlockItemSorter sorter_;
+};
+
+} // namespace xsim
+
+#endif // ENTERLOGIC_H
@@ -0,0 +1,223 @@
+#ifndef ENTITYSIDETABLE_H
+#define ENTITYSIDETABLE_H
+
+#include <xsim_config>
+#include <cstdint>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "common.h"
+#include "intrusivelist.h"
+#include "signal.hpp"
+#include "wakeupindex.h"
+
+namespace xsim {
+
+struct BatchQueueEntry;
+class BlockItem;
+class EnterLogic;
+class Entity;
+class EventProcessingResourceReady;
+class EventRequestProcessingResources;
+class EventRequestSetupResources;
+class EventSetupResourceReady;
+class Node;
+class PropertyContainer;
+struct ResourceBlockListEntry;
+
+/**
+ * @brief The rarely used data of an Entity.
+ *
+ * Blocking, assembly and resource bookkeeping is only needed by a small share
+ * of the entities, so it is kept out of the Entity itself and allocated the
+ * first time it is used.
+ */
+struct XSIM_EXPORT EntityCold {
+    /** @brief Fired when the entity is deleted. */
+    Signal<void (Entity*)> deleted;
+
+    /** @brief All destinations that blocks the entity from entering. */
+    std::vector<std::pair<Node*, std::list<Entity*>::iterator>> forward_blocking;
+
+    /** @brief All enter logics that the entity is blocked on. */
+    std::vector<std::pair<EnterLogic*, std::list<BlockItem*>::iterator>> logic_forward_blocking;
+
+    /** @brief The wake-up subscriptions of the entity while it is forward blocked. */
+    std::vector<WakeupIndex::Subscription> wakeup_subscriptions;
+
+    /** @brief The batch queues the entity waits in while it is blocked by a Batch. */
+    std::vector<BatchQueueEntry*> batch_entries;
+
+    /** @brief The simulation time the entity was forward blocked. */
+    simtime start_blocked = 0;
+
+    /** @brief The number of pieces of a lot, see Entity::set_lot. */
+    int pieces = 1;
+
+    /** @brief All assembled parts. */
+    std::vector<Entity*> parts;
+
+    /** @brief The entity used for routing, setup and processing times. */
+    Entity *assembly_identity = nullptr;
+
+    /** @brief All outstanding resource events associated with the entity. */
+    IntrusiveList<EventRequestProcessingResources, EntityLink> request_processing_resources_events;
+    IntrusiveList<EventRequestSetupResources, EntityLink> request_setup_resources_events;
+    IntrusiveList<EventProcessingResourceReady, EntityLink> processing_resource_ready_events;
+    IntrusiveList<EventSetupResourceReady, EntityLink> setup_resource_ready_events;
+
+    /** @brief Resource block list entries created on behalf of the entity. */
+    IntrusiveList<ResourceBlockListEntry, EntityLink> processing_resource_block_lists;
+    IntrusiveList<ResourceBlockListEntry, EntityLink> setup_resource_block_lists;
+
+    /** @brief The properties of the entity, created on first use. */
+    PropertyContainer *properties = nullptr;
+};
+
+/**
+ * @brief Memory used by the entities currently in the model.
+ */
+struct XSIM_EXPORT EntityMemoryReport {
+    /** @brief The number of entities. */
+    size_t entities = 0;
+
+    /** @brief The number of entities that have cold data allocated. */
+    size_t cold_entities = 0;
+
+    /** @brief The size of the hot part of each entity. */
+    size_t hot_bytes = 0;
+
+    /** @brief The total size of the cold data, including the side table. */
+    size_t cold_bytes = 0;
+
+    /**
+     * @returns The average number of bytes used per entity.
+     */
+    double bytes_per_entity() const
+    {
+        if (entities == 0)
+            return 0.0;
+        return static_cast<double>(entities * hot_bytes + cold_bytes) / entities;
+    }
+};
+
+/**
+ * @brief Holds the lazily allocated cold data of the entities.
+ *
+ * The cold data is kept in numbered slots and each entity stores the number
+ * of its slot, so finding the cold data of an entity is an index into a
+ * vector. Released slots are reused.
+ */
+class EntitySideTable {
+public:
+    /** @brief The slot number of an entity without cold data. */
+    static constexpr uint32_t NO_SLOT = 0;
+
+    EntitySideTable() = default;
+
+    /** Copying and moving side tables is not supported. */
+    EntitySideTable(const EntitySideTable&) = delete;
+    EntitySideTable& operator=(const EntitySideTable&) = delete;
+
+    ~EntitySideTable()
+    {
+        clear();
+    }
+
+    /**
+     * @param  slot The slot number stored in the entity.
+     *
+     * @returns The cold data in the slot, or nullptr if the slot is NO_SLOT.
+     */
+    EntityCold* find(uint32_t slot) const
+    {
+        return slot != NO_SLOT ? slots_[slot - 1] : nullptr;
+    }
+
+    /**
+     * @brief Allocates cold data.
+     *
+     * @returns The slot number, to be stored in the entity.
+     */
+    uint32_t allocate()
+    {
+        if (!free_.empty()) {
+            uint32_t slot = free_.back();
+            free_.pop_back();
+            slots_[slot - 1] = new EntityCold();
+            ++size_;
+            return slot;
+        }
+        slots_.push_back(new EntityCold());
+        ++size_;
+        return static_cast<uint32_t>(slots_.size());
+    }
+
+    /**
+     * @brief Releases the cold data in a slot.
+     *
+     * @param slot The slot number stored in the entity, ignored if NO_SLOT.
+     */
+    void erase(uint32_t slot)
+    {
+        if (slot == NO_SLOT || !slots_[slot - 1])
+            return;
+        delete slots_[slot - 1];
+        slots_[slot - 1] = nullptr;
+        free_.push_back(slot);
+        --size_;
+    }
+
+    /**
+     * @returns The number of entities with cold data.
+     */
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @returns An estimate of the bytes used by the side table and the cold data.
+     */
+    size_t bytes() const
+    {
+        size_t bytes = slots_.capacity() * sizeof(EntityCold*) +
+            free_.capacity() * sizeof(uint32_t) +
+            size_ * sizeof(EntityCold);
+        for (const EntityCold *cold : slots_) {
+            if (!cold)
+                continue;
+            bytes += cold->forward_blocking.capacity() * sizeof(cold->forward_blocking[0]);
+            bytes += cold->logic_forward_blocking.capacity() * sizeof(cold->logic_forward_blocking[0]);
+            bytes += cold->parts.capacity() * sizeof(Entity*);
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Releases all cold data, the entities must not use their slot
+     * numbers afterwards.
+     */
+    void clear()
+    {
+        for (EntityCold *cold : slots_)
+            delete cold;
+        slots_.clear();
+        free_.clear();
+        size_ = 0;
+    }
+
+private:
+    /** @brief The cold data by slot number minus one, nullptr for released slots. */
+    std::vector<EntityCold*> slots_;
+
+    /** @brief Released slot numbers. */
+    std::vector<uint32_t> free_;
+
+    size_t size_ = 0;
+};
+
+} // namespace xsim
+
+#endif // ENTITYSIDETABLE_H
@@ -1,16 +1,16 @@
-﻿#ifndef ENTRANCE_H
-#define ENTRANCE_H
-
-#include <xsim_config>
-
-#include "object.h"
-
-namespace xsim {
-
-/** @brief Entrance. */
-class XSIM_EXPORT Entrance : public Object {
-};
-
-} // namespace xsim
-
-#endif // ENTRANCE_H
+﻿#ifndef ENTRANCE_H
+#define ENTRANCE_H
+
+#include <xsim_config>
+
+#include "object.h"
+
+namespace xsim {
+
+/** @brief Entrance. */
+class XSIM_EXPORT Entrance : public Object {
+};
+
+} // namespace xsim
+
+#endif // ENTRANCE_H
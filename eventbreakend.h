@@ -1,29 +1,32 @@
-﻿#ifndef EVENTBREAKEND_H
-#define EVENTBREAKEND_H
-
-#include <xsim_config>
-#include <vector>
-
-#include "event.h"
-
-namespace xsim {
-
-class ShiftCalendar;
-
-class XSIM_EXPORT EventBreakEnd : public Event {
- public:
-     EventBreakEnd(ShiftCalendar *shift, int priority = PRIORITY_BREAK);
-
-     /* Documented in event.h */
-     void process() override;
-     std::string sender() override;
-     std::string receiver() override;
-     std::string name() override;
-
- private:
-     ShiftCalendar *shift_;
-};
-
-} // namespace xsim
-
-#endif // EVENTBREAKEND_H
+﻿#ifndef EVENTBREAKEND_H
+#define EVENTBREAKEND_H
+
+#include <xsim_config>
+#include <vector>
+
+#include "event.h"
+
+namespace xsim {
+
+class ShiftCalendar;
+
+class XSIM_EXPORT EventBreakEnd : public Event {
+ public:
+     EventBreakEnd(ShiftCalendar *shift, int priority = PRIORITY_BREAK);
+
+     /* Documented in event.h */
+     void process() override;
+     std::string sender() override;
+     std::string receiver() override;
+     std::string name() override;
+     Symbol sender_symbol() override;
+     Symbol receiver_symbol() override;
+     Symbol name_symbol() override;
+
+ private:
+     ShiftCalendar *shift_;
+};
+
+} // namespace xsim
+
+#endif // EVENTBREAKEND_H
@@ -0,0 +1,35 @@
+#ifndef EVENTCLOCKTICK_H
+#define EVENTCLOCKTICK_H
+
+#include <xsim_config>
+
+#include "event.h"
+
+namespace xsim {
+
+class Node;
+
+/**
+ * @brief Stands in the event list for the first pending event of a node
+ * clock, see Node::schedule_local.
+ */
+class XSIM_EXPORT EventClockTick : public Event {
+ public:
+     EventClockTick(Node *node, int priority = PRIORITY_CLOCK_TICK);
+
+     /* Documented in event.h */
+     void process() override;
+     std::string sender() override;
+     std::string receiver() override;
+     std::string name() override;
+     Symbol sender_symbol() override;
+     Symbol receiver_symbol() override;
+     Symbol name_symbol() override;
+
+ private:
+     Node *node_;
+};
+
+} // namespace xsim
+
+#endif // EVENTCLOCKTICK_H
@@ -0,0 +1,31 @@
+#ifndef EVENTPUBLISHFRAME_H
+#define EVENTPUBLISHFRAME_H
+
+#include <xsim_config>
+
+#include "event.h"
+
+namespace xsim {
+
+/**
+ * @brief Writes an animation frame with Simulation::publish_frame and
+ * schedules the next one a frame interval later.
+ */
+class XSIM_EXPORT EventPublishFrame: public Event {
+ public:
+     EventPublishFrame(int priority = PRIORITY_PUBLISH_FRAME);
+
+     /* Documented in event.h */
+     void process() override;
+     bool is_visual() const override { return true; }
+     std::string sender() override;
+     std::string receiver() override;
+     std::string name() override;
+     Symbol sender_symbol() override;
+     Symbol receiver_symbol() override;
+     Symbol name_symbol() override;
+};
+
+} // namespace xsim
+
+#endif // EVENTPUBLISHFRAME_H
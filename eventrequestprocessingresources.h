@@ -1,55 +1,61 @@
-﻿#ifndef EVENTREQUESTPROCESSINGRESOURCES_H
-#define EVENTREQUESTPROCESSINGRESOURCES_H
-
-#include <xsim_config>
-#include <vector>
-
-#include "event.h"
-
-namespace xsim {
-
-class Node;
-class Entity;
-class Simulation;
-class NodeResource;
-
-class XSIM_EXPORT EventRequestProcessingResources : public Event {
- public:
-     EventRequestProcessingResources(
-            NodeResource *resource,
-            Entity *entity,
-            Node *node,
-            bool schedule_event_out,
-            int priority,
-            int sub_priority);
-
-     /* Documented in event.h */
-     void process() override;
-     std::string sender() override;
-     std::string receiver() override;
-     std::string name() override;
-
-     /**
-      * @brief Getter for the Node associated with this event.
-      *
-      * @return Pointer to the node.
-      */
-     Node* node() const;
-
-     /**
-      * @brief Getter for the Entity associated with this event.
-      *
-      * @return Pointer to the entity.
-      */
-     Entity* entity() const;
-
- private:
-     NodeResource *resource_;
-     Entity *entity_;
-     Node *node_;
-     bool schedule_event_out_;
-};
-
-} // namespace xsim
-
-#endif // EVENTREQUESTPROCESSINGRESOURCES_H
+﻿#ifndef EVENTREQUESTPROCESSINGRESOURCES_H
+#define EVENTREQUESTPROCESSINGRESOURCES_H
+
+#include <xsim_config>
+#include <vector>
+
+#include "event.h"
+#include "intrusivelist.h"
+
+namespace xsim {
+
+class Node;
+class Entity;
+class Simulation;
+class NodeResource;
+
+class XSIM_EXPORT EventRequestProcessingResources : public Event,
+        public IntrusiveListHook<NodeLink>,
+        public IntrusiveListHook<EntityLink> {
+ public:
+     EventRequestProcessingResources(
+            NodeResource *resource,
+            Entity *entity,
+            Node *node,
+            bool schedule_event_out,
+            int priority,
+            int sub_priority);
+
+     /* Documented in event.h */
+     void process() override;
+     std::string sender() override;
+     std::string receiver() override;
+     std::string name() override;
+     Symbol sender_symbol() override;
+     Symbol receiver_symbol() override;
+     Symbol name_symbol() override;
+
+     /**
+      * @brief Getter for the Node associated with this event.
+      *
+      * @return Pointer to the node.
+      */
+     Node* node() const;
+
+     /**
+      * @brief Getter for the Entity associated with this event.
+      *
+      * @return Pointer to the entity.
+      */
+     Entity* entity() const;
+
+ private:
+     NodeResource *resource_;
+     Entity *entity_;
+     Node *node_;
+     bool schedule_event_out_;
+};
+
+} // namespace xsim
+
+#endif // EVENTREQUESTPROCESSINGRESOURCES_H
@@ -1,30 +1,33 @@
-﻿#ifndef EVENTSHIFTCALENDARSTART_H
-#define EVENTSHIFTCALENDARSTART_H
-
-#include <xsim_config>
-#include <vector>
-
-#include "event.h"
-
-namespace xsim {
-
-class ShiftCalendar;
-
-class XSIM_EXPORT EventShiftCalendarStart : public Event {
- public:
-     EventShiftCalendarStart(ShiftCalendar *shift,
-             int priority = PRIORITY_SHIFT_CALENDAR_START);
-
-     /* Documented in event.h */
-     void process() override;
-     std::string sender() override;
-     std::string receiver() override;
-     std::string name() override;
-
- private:
-     ShiftCalendar *shift_;
-};
-
-} // namespace xsim
-
-#endif // EVENTSHIFTCALENDARSTART_H
+﻿#ifndef EVENTSHIFTCALENDARSTART_H
+#define EVENTSHIFTCALENDARSTART_H
+
+#include <xsim_config>
+#include <vector>
+
+#include "event.h"
+
+namespace xsim {
+
+class ShiftCalendar;
+
+class XSIM_EXPORT EventShiftCalendarStart : public Event {
+ public:
+     EventShiftCalendarStart(ShiftCalendar *shift,
+             int priority = PRIORITY_SHIFT_CALENDAR_START);
+
+     /* Documented in event.h */
+     void process() override;
+     std::string sender() override;
+     std::string receiver() override;
+     std::string name() override;
+     Symbol sender_symbol() override;
+     Symbol receiver_symbol() override;
+     Symbol name_symbol() override;
+
+ private:
+     ShiftCalendar *shift_;
+};
+
+} // namespace xsim
+
+#endif // EVENTSHIFTCALENDARSTART_H
@@ -1,16 +1,16 @@
-﻿#ifndef EXIT_H
-#define EXIT_H
-
-#include <xsim_config>
-
-#include "object.h"
-
-namespace xsim {
-
-/** @brief Exit. */
-class XSIM_EXPORT Exit : public Object {
-};
-
-} // namespace xsim
-
-#endif // EXIT_H
+﻿#ifndef EXIT_H
+#define EXIT_H
+
+#include <xsim_config>
+
+#include "object.h"
+
+namespace xsim {
+
+/** @brief Exit. */
+class XSIM_EXPORT Exit : public Object {
+};
+
+} // namespace xsim
+
+#endif // EXIT_H
@@ -0,0 +1,656 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common.h"
+#include "variable.h"
+
+namespace xsim {
+
+/**
+ * @brief A compiled arithmetic expression.
+ *
+ * The expression is stored as bytecode for a small stack machine. Constant
+ * sub-expressions are folded when the expression is compiled, and the
+ * variables it reads are recorded so it only needs to be re-evaluated when
+ * one of them changes. The last evaluated value is cached.
+ */
+class XSIM_EXPORT Expression {
+public:
+    enum Op : uint8_t {
+        PUSH_CONST, PUSH_VAR, NEG,
+        ADD, SUB, MUL, DIV, POW,
+        LT, GT, LE, GE, EQ, NE, AND, OR,
+        SELECT, CALL
+    };
+
+    struct Instruction {
+        Op op;
+        uint8_t argc;
+        uint32_t operand;
+    };
+
+    typedef double (*Function)(const double* args, size_t argc);
+
+    /** @brief The maximum stack depth of an expression. */
+    static constexpr size_t MAX_DEPTH = 64;
+
+    /**
+     * @returns The source text of the expression.
+     */
+    const std::string& text() const { return text_; }
+
+    /**
+     * @returns True if the expression does not depend on any variable.
+     */
+    bool is_constant() const { return variables_.empty(); }
+
+    /**
+     * @returns The variables the expression reads.
+     */
+    const std::vector<Variable*>& variables() const { return variables_; }
+
+    /**
+     * @returns The value from the last evaluation.
+     */
+    double value() const { return value_; }
+
+    /**
+     * @returns The number of instructions, after constant folding.
+     */
+    size_t size() const { return code_.size(); }
+
+    /**
+     * @brief Evaluates the expression and caches the value.
+     *
+     * @returns The new value.
+     */
+    double evaluate()
+    {
+        value_ = run();
+        return value_;
+    }
+
+private:
+    friend class ExpressionCompiler;
+
+    double run() const
+    {
+        double stack[MAX_DEPTH];
+        size_t top = 0;
+        for (const Instruction& instruction : code_) {
+            switch (instruction.op) {
+            case PUSH_CONST:
+                stack[top++] = constants_[instruction.operand];
+                break;
+            case PUSH_VAR:
+                stack[top++] = variables_[instruction.operand]->value_;
+                break;
+            case NEG:
+                stack[top - 1] = -stack[top - 1];
+                break;
+            case SELECT:
+                top -= 2;
+                stack[top - 1] = stack[top - 1] != 0.0 ? stack[top] : stack[top + 1];
+                break;
+            case CALL:
+                top -= instruction.argc;
+                stack[top] = functions_[instruction.operand](&stack[top], instruction.argc);
+                ++top;
+                break;
+            default:
+                --top;
+                stack[top - 1] = binary(instruction.op, stack[top - 1], stack[top]);
+                break;
+            }
+        }
+        return top ? stack[top - 1] : 0.0;
+    }
+
+    static double binary(Op op, double lhs, double rhs)
+    {
+        switch (op) {
+        case ADD: return lhs + rhs;
+        case SUB: return lhs - rhs;
+        case MUL: return lhs * rhs;
+        case DIV: return lhs / rhs;
+        case POW: return std::pow(lhs, rhs);
+        case LT: return lhs < rhs;
+        case GT: return lhs > rhs;
+        case LE: return lhs <= rhs;
+        case GE: return lhs >= rhs;
+        case EQ: return lhs == rhs;
+        case NE: return lhs != rhs;
+        case AND: return lhs != 0.0 && rhs != 0.0;
+        case OR: return lhs != 0.0 || rhs != 0.0;
+        default: return 0.0;
+        }
+    }
+
+    std::string text_;
+    std::vector<Instruction> code_;
+    std::vector<double> constants_;
+    std::vector<Variable*> variables_;
+    std::vector<Function> functions_;
+    double value_ = 0.0;
+};
+
+/**
+ * @brief Compiles expression strings into shared Expression objects.
+ *
+ * The grammar is the one of the muParser default configuration that Double
+ * and Int used before: numbers, variables, the constants _pi and _e, the
+ * operators + - * / ^, comparisons, && and ||, the ternary operator,
+ * parentheses and the muParser built-in functions. Identical strings compile
+ * to the same Expression. The compiler keeps track of which expressions read
+ * each variable, so that changing a variable only re-evaluates the
+ * expressions that depend on it.
+ */
+class XSIM_EXPORT ExpressionCompiler {
+public:
+    typedef std::function<Variable* (std::string_view name)> VariableResolver;
+
+    ExpressionCompiler() = default;
+
+    /** Copying and moving compilers is not supported. */
+    ExpressionCompiler(const ExpressionCompiler&) = delete;
+    ExpressionCompiler& operator=(const ExpressionCompiler&) = delete;
+
+    /**
+     * @brief Sets the function used to look up variables by name.
+     *
+     * @param resolver The resolver, it returns nullptr for unknown names.
+     */
+    void set_variable_resolver(VariableResolver resolver) { resolver_ = std::move(resolver); }
+
+    /**
+     * @brief Compiles and evaluates an expression.
+     *
+     * @param text The expression.
+     *
+     * @returns The compiled expression, owned by the compiler and valid until
+     *          @ref clear is called.
+     *
+     * @throws bad_setting If the expression can not be parsed.
+     */
+    Expression* compile(const std::string& text)
+    {
+        auto i = cache_.find(text);
+        if (i != cache_.end())
+            return i->second.get();
+
+        auto expression = std::make_unique<Expression>();
+        expression->text_ = text;
+        Parser parser(*this, *expression, text);
+        parser.parse();
+        expression->evaluate();
+
+        Expression* result = expression.get();
+        for (Variable* variable : result->variables_)
+            dependents_[variable].push_back(result);
+        cache_.emplace(text, std::move(expression));
+        return result;
+    }
+
+    /**
+     * @brief Re-evaluates the expressions that read a variable.
+     *
+     * @param variable The variable that has changed.
+     *
+     * @returns The number of re-evaluated expressions.
+     */
+    size_t variable_changed(Variable* variable)
+    {
+        auto i = dependents_.find(variable);
+        if (i == dependents_.end())
+            return 0;
+        for (Expression* expression : i->second)
+            expression->evaluate();
+        return i->second.size();
+    }
+
+    /**
+     * @brief Detaches the expressions that read a variable before it is
+     *        deleted.
+     *
+     * The variable is replaced by its current value in the expressions, so
+     * parameters that use them keep their last value.
+     *
+     * @param variable The variable that is removed.
+     */
+    void variable_removed(Variable* variable)
+    {
+        auto i = dependents_.find(variable);
+        if (i == dependents_.end())
+            return;
+        for (Expression* expression : i->second) {
+            auto& variables = expression->variables_;
+            uint32_t index = static_cast<uint32_t>(
+                std::find(variables.begin(), variables.end(), variable) - variables.begin());
+            uint32_t constant = static_cast<uint32_t>(expression->constants_.size());
+            expression->constants_.push_back(variable->value_);
+            for (Expression::Instruction& instruction : expression->code_) {
+                if (instruction.op != Expression::PUSH_VAR || instruction.operand < index)
+                    continue;
+                if (instruction.operand == index)
+                    instruction = { Expression::PUSH_CONST, 0, constant };
+                else
+                    --instruction.operand;
+            }
+            variables.erase(variables.begin() + index);
+        }
+        dependents_.erase(i);
+    }
+
+    /**
+     * @returns The number of distinct compiled expressions.
+     */
+    size_t size() const { return cache_.size(); }
+
+    /**
+     * @brief Removes all compiled expressions.
+     */
+    void clear()
+    {
+        dependents_.clear();
+        cache_.clear();
+    }
+
+private:
+    struct FunctionInfo {
+        const char* name;
+        int argc;
+        Expression::Function function;
+    };
+
+    static const FunctionInfo* find_function(std::string_view name)
+    {
+        static const FunctionInfo functions[] = {
+            { "sin", 1, [](const double* a, size_t) { return std::sin(a[0]); } },
+            { "cos", 1, [](const double* a, size_t) { return std::cos(a[0]); } },
+            { "tan", 1, [](const double* a, size_t) { return std::tan(a[0]); } },
+            { "asin", 1, [](const double* a, size_t) { return std::asin(a[0]); } },
+            { "acos", 1, [](const double* a, size_t) { return std::acos(a[0]); } },
+            { "atan", 1, [](const double* a, size_t) { return std::atan(a[0]); } },
+            { "sinh", 1, [](const double* a, size_t) { return std::sinh(a[0]); } },
+            { "cosh", 1, [](const double* a, size_t) { return std::cosh(a[0]); } },
+            { "tanh", 1, [](const double* a, size_t) { return std::tanh(a[0]); } },
+            { "asinh", 1, [](const double* a, size_t) { return std::asinh(a[0]); } },
+            { "acosh", 1, [](const double* a, size_t) { return std::acosh(a[0]); } },
+            { "atanh", 1, [](const double* a, size_t) { return std::atanh(a[0]); } },
+            { "sqrt", 1, [](const double* a, size_t) { return std::sqrt(a[0]); } },
+            { "exp", 1, [](const double* a, size_t) { return std::exp(a[0]); } },
+            { "ln", 1, [](const double* a, size_t) { return std::log(a[0]); } },
+            { "log", 1, [](const double* a, size_t) { return std::log(a[0]); } },
+            { "log2", 1, [](const double* a, size_t) { return std::log2(a[0]); } },
+            { "log10", 1, [](const double* a, size_t) { return std::log10(a[0]); } },
+            { "abs", 1, [](const double* a, size_t) { return std::fabs(a[0]); } },
+            { "rint", 1, [](const double* a, size_t) { return std::rint(a[0]); } },
+            { "sign", 1, [](const double* a, size_t) { return a[0] > 0.0 ? 1.0 : (a[0] < 0.0 ? -1.0 : 0.0); } },
+            { "min", -1, [](const double* a, size_t n) { return *std::min_element(a, a + n); } },
+            { "max", -1, [](const double* a, size_t n) { return *std::max_element(a, a + n); } },
+            { "sum", -1, [](const double* a, size_t n) { double s = 0.0; for (size_t i = 0; i < n; ++i) s += a[i]; return s; } },
+            { "avg", -1, [](const double* a, size_t n) { double s = 0.0; for (size_t i = 0; i < n; ++i) s += a[i]; return s / n; } },
+        };
+        for (const FunctionInfo& info : functions) {
+            if (name == info.name)
+                return &info;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief A recursive descent parser that emits bytecode and folds
+     *        constants as it goes.
+     */
+    class Parser {
+    public:
+        Parser(ExpressionCompiler& compiler, Expression& expression, std::string_view text) :
+            compiler_(compiler), expression_(expression), text_(text), pos_(0) {}
+
+        void parse()
+        {
+            ternary();
+            skip_space();
+            if (pos_ != text_.size())
+                error("unexpected character");
+            if (expression_.code_.empty())
+                error("empty expression");
+            if (max_depth() > Expression::MAX_DEPTH)
+                error("expression is nested too deep");
+        }
+
+    private:
+        void ternary()
+        {
+            logical_or();
+            if (accept("?")) {
+                ternary();
+                expect(":");
+                ternary();
+                emit(Expression::SELECT, 3);
+            }
+        }
+
+        void logical_or()
+        {
+            logical_and();
+            while (accept("||")) {
+                logical_and();
+                emit(Expression::OR, 2);
+            }
+        }
+
+        void logical_and()
+        {
+            comparison();
+            while (accept("&&")) {
+                comparison();
+                emit(Expression::AND, 2);
+            }
+        }
+
+        void comparison()
+        {
+            additive();
+            for (;;) {
+                Expression::Op op;
+                if (accept("<="))
+                    op = Expression::LE;
+                else if (accept(">="))
+                    op = Expression::GE;
+                else if (accept("=="))
+                    op = Expression::EQ;
+                else if (accept("!="))
+                    op = Expression::NE;
+                else if (accept("<"))
+                    op = Expression::LT;
+                else if (accept(">"))
+                    op = Expression::GT;
+                else
+                    return;
+                additive();
+                emit(op, 2);
+            }
+        }
+
+        void additive()
+        {
+            multiplicative();
+            for (;;) {
+                if (accept("+")) {
+                    multiplicative();
+                    emit(Expression::ADD, 2);
+                } else if (accept("-")) {
+                    multiplicative();
+                    emit(Expression::SUB, 2);
+                } else {
+                    return;
+                }
+            }
+        }
+
+        void multiplicative()
+        {
+            unary();
+            for (;;) {
+                if (accept("*")) {
+                    unary();
+                    emit(Expression::MUL, 2);
+                } else if (accept("/")) {
+                    unary();
+                    emit(Expression::DIV, 2);
+                } else {
+                    return;
+                }
+            }
+        }
+
+        void unary()
+        {
+            if (accept("-")) {
+                unary();
+                emit(Expression::NEG, 1);
+            } else if (accept("+")) {
+                unary();
+            } else {
+                power();
+            }
+        }
+
+        void power()
+        {
+            primary();
+            if (accept("^")) {
+                unary();
+                emit(Expression::POW, 2);
+            }
+        }
+
+        void primary()
+        {
+            skip_space();
+            if (accept("(")) {
+                ternary();
+                expect(")");
+                return;
+            }
+
+            if (pos_ < text_.size() && (is_digit(text_[pos_]) || text_[pos_] == '.')) {
+                number();
+                return;
+            }
+
+            std::string_view name = identifier();
+            if (name.empty())
+                error("expected a value");
+
+            if (accept("(")) {
+                call(name);
+                return;
+            }
+
+            if (name == "_pi") {
+                push_constant(3.14159265358979323846);
+            } else if (name == "_e") {
+                push_constant(2.71828182845904523536);
+            } else {
+                Variable* variable = compiler_.resolver_ ? compiler_.resolver_(name) : nullptr;
+                if (!variable)
+                    error("unknown variable '" + std::string(name) + "'");
+                push_variable(variable);
+            }
+        }
+
+        void number()
+        {
+            double value = 0.0;
+            auto [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), value);
+            if (ec != std::errc())
+                error("invalid number");
+            pos_ = end - text_.data();
+            push_constant(value);
+        }
+
+        void call(std::string_view name)
+        {
+            const FunctionInfo* info = find_function(name);
+            if (!info)
+                error("unknown function '" + std::string(name) + "'");
+
+            int argc = 0;
+            if (!accept(")")) {
+                do {
+                    ternary();
+                    ++argc;
+                } while (accept(","));
+                expect(")");
+            }
+
+            if ((info->argc >= 0 && argc != info->argc) || argc == 0 || argc > 255)
+                error("wrong number of arguments to '" + std::string(name) + "'");
+
+            auto& functions = expression_.functions_;
+            auto i = std::find(functions.begin(), functions.end(), info->function);
+            uint32_t index = static_cast<uint32_t>(i - functions.begin());
+            if (i == functions.end())
+                functions.push_back(info->function);
+            emit({ Expression::CALL, static_cast<uint8_t>(argc), index }, argc);
+        }
+
+        void push_constant(double value)
+        {
+            expression_.constants_.push_back(value);
+            expression_.code_.push_back(
+                { Expression::PUSH_CONST, 0, static_cast<uint32_t>(expression_.constants_.size() - 1) });
+        }
+
+        void push_variable(Variable* variable)
+        {
+            auto& variables = expression_.variables_;
+            auto i = std::find(variables.begin(), variables.end(), variable);
+            uint32_t index = static_cast<uint32_t>(i - variables.begin());
+            if (i == variables.end())
+                variables.push_back(variable);
+            expression_.code_.push_back({ Expression::PUSH_VAR, 0, index });
+        }
+
+        void emit(Expression::Op op, int operands)
+        {
+            emit({ op, 0, 0 }, operands);
+        }
+
+        /**
+         * @brief Emits an instruction, folding it into a constant if all its
+         *        operands are constants.
+         */
+        void emit(Expression::Instruction instruction, int operands)
+        {
+            auto& code = expression_.code_;
+            code.push_back(instruction);
+
+            size_t n = static_cast<size_t>(operands);
+            if (code.size() < n + 1)
+                return;
+            for (size_t i = code.size() - 1 - n; i < code.size() - 1; ++i) {
+                if (code[i].op != Expression::PUSH_CONST)
+                    return;
+            }
+
+            Expression folded;
+            folded.constants_ = expression_.constants_;
+            folded.functions_ = expression_.functions_;
+            folded.code_.assign(code.end() - n - 1, code.end());
+            double value = folded.run();
+
+            code.erase(code.end() - n - 1, code.end());
+            expression_.constants_.resize(constants_in_use());
+            push_constant(value);
+        }
+
+        size_t max_depth() const
+        {
+            size_t depth = 0;
+            size_t max = 0;
+            for (const Expression::Instruction& instruction : expression_.code_) {
+                switch (instruction.op) {
+                case Expression::PUSH_CONST:
+                case Expression::PUSH_VAR:
+                    ++depth;
+                    break;
+                case Expression::NEG:
+                    break;
+                case Expression::SELECT:
+                    depth -= 2;
+                    break;
+                case Expression::CALL:
+                    depth -= instruction.argc - 1;
+                    break;
+                default:
+                    --depth;
+                    break;
+                }
+                max = std::max(max, depth);
+            }
+            return max;
+        }
+
+        size_t constants_in_use() const
+        {
+            size_t count = 0;
+            for (const Expression::Instruction& instruction : expression_.code_) {
+                if (instruction.op == Expression::PUSH_CONST)
+                    count = std::max<size_t>(count, instruction.operand + 1);
+            }
+            return count;
+        }
+
+        std::string_view identifier()
+        {
+            skip_space();
+            size_t start = pos_;
+            while (pos_ < text_.size() && (is_alpha(text_[pos_]) || is_digit(text_[pos_]) || text_[pos_] == '.'))
+                ++pos_;
+            return text_.substr(start, pos_ - start);
+        }
+
+        bool accept(std::string_view token)
+        {
+            skip_space();
+            if (text_.substr(pos_, token.size()) != token)
+                return false;
+            pos_ += token.size();
+            return true;
+        }
+
+        void expect(std::string_view token)
+        {
+            if (!accept(token))
+                error("expected '" + std::string(token) + "'");
+        }
+
+        void skip_space()
+        {
+            while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t'))
+                ++pos_;
+        }
+
+        static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+        static bool is_alpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+
+        [[noreturn]] void error(const std::string& message)
+        {
+            throw bad_setting("Invalid expression '" + std::string(text_) + "' at position " +
+                              std::to_string(pos_) + ": " + message);
+        }
+
+        ExpressionCompiler& compiler_;
+        Expression& expression_;
+        std::string_view text_;
+        size_t pos_;
+    };
+
+    /** @brief Looks up variables by name. */
+    VariableResolver resolver_;
+
+    /** @brief All compiled expressions by source text. */
+    std::unordered_map<std::string, std::unique_ptr<Expression>> cache_;
+
+    /** @brief The expressions that read each variable. */
+    std::unordered_map<Variable*, std::vector<Expression*>> dependents_;
+};
+
+} // namespace xsim
+
+#endif // EXPRESSION_H
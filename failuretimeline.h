@@ -0,0 +1,323 @@
+#ifndef FAILURETIMELINE_H
+#define FAILURETIMELINE_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "indexedheap.h"
+#include "numbergenerator.h"
+
+namespace xsim {
+
+class Failure;
+
+/**
+ * @brief The down periods of a failure, sampled in advance.
+ *
+ * Used for failures with time reference SIMULATION, where the time to the
+ * next failure does not depend on anything that happens in the model. The
+ * intervals and durations are drawn in blocks from their number generators,
+ * the down periods up to the horizon when the timeline is sampled and a
+ * further block whenever the simulation passes the last sampled one, so a
+ * run past the horizon keeps failing.
+ *
+ * The timeline is the same as the one the events would have produced as
+ * long as the two generators draw from their own variate streams, each then
+ * draws the same values in the same order. When the interval and the
+ * duration are the same generator the draws alternate as they would one
+ * failure at a time. Generators that share a stream in any other way, for
+ * example with the failures of other nodes, draw their values in another
+ * order than the events would, the timeline then has the same distribution
+ * but not the same values.
+ */
+class FailureTimeline {
+public:
+    /** @brief A down period. */
+    struct Down {
+        simtime begin;
+        simtime end;
+    };
+
+    /** @brief The number of values drawn from a generator at a time. */
+    static constexpr size_t BLOCK = 64;
+
+    FailureTimeline() = default;
+
+    /**
+     * @brief Samples the down periods that begin before the horizon, and
+     * possibly a few more.
+     *
+     * @param interval The generator for the time between the end of one
+     *                 down period and the begin of the next.
+     * @param duration The generator for the length of a down period.
+     * @param start    The time the first interval starts.
+     * @param horizon  The end of the replication.
+     */
+    void sample(NumberGenerator *interval, NumberGenerator *duration, simtime start, simtime horizon)
+    {
+        clear();
+        interval_ = interval;
+        duration_ = duration;
+        time_ = start;
+        while (time_ < horizon && extend()) {}
+    }
+
+    /**
+     * @brief Delays the remaining down periods, used when a disruption is
+     * canceled or its end is postponed.
+     *
+     * @param delay The delay in seconds.
+     */
+    void shift(simtime delay)
+    {
+        if (position_ >= downs_.size())
+            return;
+        if (ended_)
+            downs_[position_].begin += delay;
+        downs_[position_].end += delay;
+        for (size_t i = position_ + 1; i < downs_.size(); ++i) {
+            downs_[i].begin += delay;
+            downs_[i].end += delay;
+        }
+        time_ += delay;
+    }
+
+    /**
+     * @returns True if all down periods have been passed, only when the
+     * timeline has not been sampled.
+     */
+    bool finished() const { return position_ >= downs_.size(); }
+
+    /**
+     * @returns True if the next transition is the begin of a down period.
+     */
+    bool next_is_begin() const { return ended_; }
+
+    /**
+     * @returns The time of the next transition, the timeline must not be finished.
+     */
+    simtime next_time() const
+    {
+        return ended_ ? downs_[position_].begin : downs_[position_].end;
+    }
+
+    /**
+     * @brief Passes the next transition, samples another block when the
+     * last sampled down period ends.
+     */
+    void advance()
+    {
+        if (!ended_ && ++position_ >= downs_.size())
+            extend();
+        ended_ = !ended_;
+    }
+
+    /**
+     * @param time A simulation time.
+     *
+     * @returns True if the failure is down at @p time, as far as it has been sampled.
+     */
+    bool is_down(simtime time) const
+    {
+        auto it = std::upper_bound(downs_.begin(), downs_.end(), time,
+                                   [](simtime t, const Down& down) { return t < down.begin; });
+        return it != downs_.begin() && time < std::prev(it)->end;
+    }
+
+    /**
+     * @param until A simulation time, usually the horizon.
+     *
+     * @returns The total down time before @p until.
+     */
+    simtime down_time(simtime until) const
+    {
+        simtime total = 0;
+        for (const Down& down : downs_) {
+            if (down.begin >= until)
+                break;
+            total += (down.end < until ? down.end : until) - down.begin;
+        }
+        return total;
+    }
+
+    /**
+     * @returns The sampled down periods in time order.
+     */
+    const std::vector<Down>& downs() const { return downs_; }
+
+    /**
+     * @returns The number of sampled down periods.
+     */
+    size_t size() const { return downs_.size(); }
+
+    /**
+     * @brief Removes all down periods.
+     */
+    void clear()
+    {
+        downs_.clear();
+        position_ = 0;
+        ended_ = true;
+        interval_ = nullptr;
+        duration_ = nullptr;
+        time_ = 0;
+    }
+
+private:
+    /**
+     * @brief Samples the next block of down periods.
+     *
+     * @returns False if the timeline has not been sampled.
+     */
+    bool extend()
+    {
+        if (!interval_ || !duration_)
+            return false;
+        simtime intervals[BLOCK];
+        simtime durations[BLOCK];
+        if (interval_ == duration_) {
+            for (size_t i = 0; i < BLOCK; ++i) {
+                intervals[i] = interval_->next();
+                durations[i] = duration_->next();
+            }
+        } else {
+            for (size_t i = 0; i < BLOCK; ++i)
+                intervals[i] = interval_->next();
+            for (size_t i = 0; i < BLOCK; ++i)
+                durations[i] = duration_->next();
+        }
+        for (size_t i = 0; i < BLOCK; ++i) {
+            simtime begin = time_ + intervals[i];
+            time_ = begin + durations[i];
+            downs_.push_back(Down{ begin, time_ });
+        }
+        return true;
+    }
+
+    std::vector<Down> downs_;
+    size_t position_ = 0;
+    bool ended_ = true;
+    NumberGenerator *interval_ = nullptr;
+    NumberGenerator *duration_ = nullptr;
+    /** @brief The end of the last sampled down period. */
+    simtime time_ = 0;
+};
+
+/**
+ * @brief Merges the timelines of several failures into a single sequence
+ * of transitions.
+ *
+ * A failure zone keeps one cursor for the pre-sampled failures of its nodes
+ * and schedules a single event for the transition that comes first, instead
+ * of every failure keeping its own begin or end event in the event list.
+ */
+class DisruptionCursor {
+public:
+    /** @brief The next begin or end of a down period. */
+    struct Transition {
+        simtime time;
+        Failure *failure;
+        bool begin;
+    };
+
+    /**
+     * @brief Adds a failure.
+     *
+     * @param failure  The failure.
+     * @param timeline The timeline of the failure, must outlive the cursor.
+     */
+    void add(Failure *failure, FailureTimeline *timeline)
+    {
+        timelines_.push_back(Source{ failure, timeline });
+        update(timelines_.size() - 1);
+    }
+
+    /**
+     * @returns True if no transitions are left.
+     */
+    bool empty() const { return heap_.empty(); }
+
+    /**
+     * @returns The transition that comes first, the cursor must not be empty.
+     */
+    Transition next() const
+    {
+        const Entry& entry = heap_.top();
+        const Source& source = timelines_[entry.source];
+        return Transition{ entry.time, source.failure, source.timeline->next_is_begin() };
+    }
+
+    /**
+     * @brief Passes the transition that comes first.
+     */
+    void advance()
+    {
+        uint32_t source = heap_.top().source;
+        timelines_[source].timeline->advance();
+        update(source);
+    }
+
+    /**
+     * @brief Reorders a failure after its timeline was shifted.
+     *
+     * @param failure The failure.
+     */
+    void refresh(Failure *failure)
+    {
+        for (size_t i = 0; i < timelines_.size(); ++i)
+            if (timelines_[i].failure == failure)
+                update(i);
+    }
+
+    /**
+     * @brief Removes all failures.
+     */
+    void clear()
+    {
+        timelines_.clear();
+        heap_.clear();
+    }
+
+private:
+    struct Source {
+        Failure *failure;
+        FailureTimeline *timeline;
+    };
+
+    struct Entry {
+        simtime time;
+        uint32_t source;
+    };
+
+    struct Earlier {
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return a.time < b.time || (a.time == b.time && a.source < b.source);
+        }
+    };
+
+    struct SourceOf {
+        uint32_t operator()(const Entry& entry) const { return entry.source; }
+    };
+
+    void update(size_t index)
+    {
+        uint32_t source = static_cast<uint32_t>(index);
+        const FailureTimeline *timeline = timelines_[index].timeline;
+        if (timeline->finished())
+            heap_.erase(source);
+        else
+            heap_.push(Entry{ timeline->next_time(), source });
+    }
+
+    std::vector<Source> timelines_;
+    IndexedHeap<Entry, Earlier, SourceOf> heap_;
+};
+
+} // namespace xsim
+
+#endif // FAILURETIMELINE_H
@@ -1,80 +1,190 @@
-﻿#ifndef FAILUREZONE_H
-#define FAILUREZONE_H
-
-#include <xsim_config>
-#include <string>
-
-#include "node.h"
-#include "int.h"
-
-namespace xsim {
-
-class EventDisruptionBegin;
-class Failure;
-class NumberGenerator;
-class Simulation;
-
-/**
- * @brief A node that process one movble unit at a time.
- */
-class XSIM_EXPORT FailureZone : public Node {
- public:
-     /**
-      * @brief Constructor.
-      * @param propagation_steps How many levels (steps) a failure should be
-      * propagated.
-      */
-     FailureZone(Int propagation_steps);
-
-     /* Documented in node.h */
-     void disruption_begin(Failure *failure,
-            std::map<Node*, bool> &visited, int level, 
-            bool propagate_failure = true) override;
-     void disruption_end(Failure *failure,
-            std::map<Node*, bool> &visited, int level, 
-            bool propagate_failure = true) override;
-     size_t max_occupation() const override;
-     size_t content_size() const override;
-
-     /**
-      * @returns The maximum number of propagation steps.
-      */
-     Int propagation_steps() const;
-
-     /**
-      * @brief Add a regular, non-failure zone, node that we should propagate
-      * failures to.
-      *
-      * @param node The node to propagate failures to.
-      */
-     void add_node(Node *node);
-
-     /**
-      * @brief Add a failure zone that we should propagate failures to.
-      *
-      * @param node The failure zone to propagate failures to.
-      */
-     void add_failure_zone(Node *node);
-
- private:
-
-     /**
-      * @brief All non-failure zone nodes that we propagate failures to.
-      */
-     std::vector<Node*> nodes_;
-
-     /**
-      * @brief All failure zones that we propagate failures to.
-      */
-     std::vector<Node*> failure_zones_;
-
-     /**
-      * @brief The number of steps failures that originate in one of our
-      * immidiate nodes should be propagated.
-      */
-     Int propagation_steps_;
-};
-
-} // namespace xsim
-
-#endif // FAILUREZONE_H
+﻿#ifndef FAILUREZONE_H
+#define FAILUREZONE_H
+
+#include <xsim_config>
+#include <string>
+#include <unordered_set>
+
+#include "failuretimeline.h"
+#include "node.h"
+#include "int.h"
+
+namespace xsim {
+
+class Event;
+class EventDisruptionBegin;
+class Failure;
+class NumberGenerator;
+class Simulation;
+
+/**
+ * @brief A node that process one movble unit at a time.
+ */
+class XSIM_EXPORT FailureZone : public Node {
+ public:
+     /**
+      * @brief Constructor.
+      * @param propagation_steps How many levels (steps) a failure should be
+      * propagated.
+      */
+     FailureZone(Int propagation_steps);
+
+     /* Documented in node.h */
+     void disruption_begin(Failure *failure,
+            DisruptionWalk &walk, int level, 
+            bool propagate_failure = true) override;
+     void disruption_end(Failure *failure,
+            DisruptionWalk &walk, int level, 
+            bool propagate_failure = true) override;
+     size_t max_occupation() const override;
+     size_t content_size() const override;
+
+     /**
+      * @returns The maximum number of propagation steps. Read once by
+      * simulation_init when the propagation closure is built, a later change
+      * takes effect at the next initialization.
+      */
+     Int propagation_steps() const;
+
+     /**
+      * @brief Add a regular, non-failure zone, node that we should propagate
+      * failures to.
+      *
+      * @param node The node to propagate failures to.
+      */
+     void add_node(Node *node);
+
+     /**
+      * @brief Add a failure zone that we should propagate failures to.
+      *
+      * @param node The failure zone to propagate failures to.
+      */
+     void add_failure_zone(Node *node);
+
+     /* Documented in object.h */
+     void simulation_init() override;
+
+     /**
+      * @brief The merged timelines of the pre-sampled failures of this zone
+      * and its nodes, see Failure::set_presampled.
+      *
+      * Only the transition that comes first is in the event list. When it has
+      * been processed the failure calls disruption_transition_done and the
+      * zone schedules the next one.
+      *
+      * @return The cursor.
+      */
+     const DisruptionCursor& disruption_cursor() const { return disruption_cursor_; }
+
+     /**
+      * @brief Advance the cursor past the transition that was just processed
+      * and schedule the next one.
+      */
+     void disruption_transition_done();
+
+     /**
+      * @brief Reorder a failure whose timeline was shifted because its
+      * disruption was canceled or postponed, and reschedule if it is now first.
+      *
+      * @param failure The failure.
+      */
+     void disruption_timeline_shifted(Failure *failure);
+
+     /**
+      * @brief The nodes and failure zones a disruption of this zone reaches,
+      * with the level each is first reached at, computed in simulation_init
+      * from nodes_ and failure_zones_ and limited by propagation_steps() as
+      * it was then.
+      *
+      * The closure is in the depth first order of the recursion it replaces:
+      * the nodes of a zone, then each of its failure zones followed by what
+      * that zone reaches. disruption_begin and disruption_end push the closure
+      * on the walk in one go instead of descending zone by zone, so the nodes
+      * are disrupted in the same order.
+      *
+      * @return The propagation closure.
+      */
+     const std::vector<DisruptionWalk::Step>& propagation_closure() const
+     {
+         return propagation_closure_;
+     }
+
+ private:
+     /**
+      * @brief Schedule a begin or end event for the first transition of the cursor.
+      */
+     void schedule_next_disruption();
+
+     /**
+      * @brief The merged timelines of the pre-sampled failures.
+      */
+     DisruptionCursor disruption_cursor_;
+
+     /**
+      * @brief The scheduled transition event, if any.
+      */
+     Event *next_disruption_event_;
+
+
+     /**
+      * @brief All non-failure zone nodes that we propagate failures to.
+      */
+     std::vector<Node*> nodes_;
+
+     /**
+      * @brief All failure zones that we propagate failures to.
+      */
+     std::vector<Node*> failure_zones_;
+
+     /**
+      * @brief The number of steps failures that originate in one of our
+      * immidiate nodes should be propagated.
+      */
+     Int propagation_steps_;
+
+     /**
+      * @brief Builds propagation_closure_ with a depth first search.
+      */
+     void compute_propagation_closure()
+     {
+         propagation_closure_.clear();
+         std::unordered_set<const Node*> reached{ this };
+         append_propagation_closure(this, 1, propagation_steps_.value(), reached);
+     }
+
+     /**
+      * @brief Appends what a zone reaches to propagation_closure_, in the
+      * order the recursion visited it.
+      *
+      * @param zone    The zone.
+      * @param level   The level the members of the zone are reached at.
+      * @param steps   The maximum level.
+      * @param reached The nodes already in the closure.
+      */
+     void append_propagation_closure(const FailureZone *zone, int level, int steps,
+                                     std::unordered_set<const Node*> &reached)
+     {
+         if (level > steps)
+             return;
+         for (Node *node : zone->nodes_) {
+             if (reached.insert(node).second)
+                 propagation_closure_.push_back(DisruptionWalk::Step{ node, level });
+         }
+         for (Node *node : zone->failure_zones_) {
+             if (!reached.insert(node).second)
+                 continue;
+             propagation_closure_.push_back(DisruptionWalk::Step{ node, level });
+             if (const FailureZone *nested = dynamic_cast<const FailureZone*>(node))
+                 append_propagation_closure(nested, level + 1, steps, reached);
+         }
+     }
+
+     /**
+      * @brief See propagation_closure().
+      */
+     std::vector<DisruptionWalk::Step> propagation_closure_;
+};
+
+} // namespace xsim
+
+#endif // FAILUREZONE_H
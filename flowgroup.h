@@ -1,17 +1,17 @@
-﻿#ifndef FLOWGROUP_H
-#define FLOWGROUP_H
-
-#include <xsim_config>
-#include <vector>
-
-#include "object.h"
-
-namespace xsim {
-
-/** @brief A flow group. */
-class XSIM_EXPORT FlowGroup : public Object {
-};
-
-} // namespace xsim
-
-#endif // FLOWGROUP_H
+﻿#ifndef FLOWGROUP_H
+#define FLOWGROUP_H
+
+#include <xsim_config>
+#include <vector>
+
+#include "object.h"
+
+namespace xsim {
+
+/** @brief A flow group. */
+class XSIM_EXPORT FlowGroup : public Object {
+};
+
+} // namespace xsim
+
+#endif // FLOWGROUP_H
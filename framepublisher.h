@@ -0,0 +1,527 @@
+#ifndef FRAMEPUBLISHER_H
+#define FRAMEPUBLISHER_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace xsim {
+
+/**
+ * @brief A named shared memory segment.
+ */
+class SharedMemorySegment {
+public:
+    SharedMemorySegment() : data_(nullptr), size_(0), owner_(false)
+#ifdef _WIN32
+        , handle_(nullptr)
+#endif
+    {}
+
+    /** Copying and moving segments is not supported. */
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    ~SharedMemorySegment()
+    {
+        close();
+    }
+
+    /**
+     * @brief Creates the segment, or opens it if @p create is false.
+     *
+     * Creating never attaches to or replaces a segment that already exists,
+     * it fails if the name is taken. A POSIX name outlives the process that
+     * created it, a name left over from a publisher that did not close can be
+     * removed with remove() once it is known to be gone.
+     *
+     * @param name   The name of the segment.
+     * @param size   The size of the segment in bytes, ignored when opening.
+     * @param create True to create the segment.
+     *
+     * @returns True if the segment is mapped.
+     */
+    bool open(const std::string& name, size_t size, bool create)
+    {
+        close();
+        name_ = name;
+        owner_ = create;
+#ifdef _WIN32
+        if (create)
+            handle_ = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                         static_cast<DWORD>(uint64_t(size) >> 32),
+                                         static_cast<DWORD>(size), name.c_str());
+        else
+            handle_ = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+        if (!handle_)
+            return false;
+        if (create && GetLastError() == ERROR_ALREADY_EXISTS) {
+            close();
+            return false;
+        }
+        data_ = MapViewOfFile(handle_, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, create ? size : 0);
+        if (!data_) {
+            close();
+            return false;
+        }
+        if (!create) {
+            MEMORY_BASIC_INFORMATION info;
+            VirtualQuery(data_, &info, sizeof(info));
+            size = info.RegionSize;
+        }
+#else
+        std::string path = name.empty() || name[0] == '/' ? name : "/" + name;
+        int fd;
+        if (create) {
+            fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        } else {
+            fd = shm_open(path.c_str(), O_RDONLY, 0);
+        }
+        if (fd < 0)
+            return false;
+        if (create && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            shm_unlink(path.c_str());
+            return false;
+        }
+        if (!create) {
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                ::close(fd);
+                return false;
+            }
+            size = static_cast<size_t>(info.st_size);
+        }
+        void *data = mmap(nullptr, size, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            if (create)
+                shm_unlink(path.c_str());
+            return false;
+        }
+        data_ = data;
+#endif
+        size_ = size;
+        return true;
+    }
+
+    /**
+     * @brief Removes the name of a segment left over by a creator that did
+     * not close it. Processes still attached to it keep their mapping.
+     *
+     * On Windows a mapping only exists while a process has it open, so there
+     * is nothing to remove.
+     *
+     * @param name The name of the segment.
+     *
+     * @returns True if the name no longer exists.
+     */
+    static bool remove(const std::string& name)
+    {
+#ifdef _WIN32
+        (void)name;
+        return true;
+#else
+        std::string path = name.empty() || name[0] == '/' ? name : "/" + name;
+        return shm_unlink(path.c_str()) == 0 || errno == ENOENT;
+#endif
+    }
+
+    /**
+     * @brief Unmaps the segment, the creator also removes its name.
+     */
+    void close()
+    {
+#ifdef _WIN32
+        if (data_)
+            UnmapViewOfFile(data_);
+        if (handle_)
+            CloseHandle(handle_);
+        handle_ = nullptr;
+#else
+        if (data_) {
+            munmap(data_, size_);
+            if (owner_)
+                shm_unlink((name_.empty() || name_[0] == '/' ? name_ : "/" + name_).c_str());
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    void* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    std::string name_;
+    void *data_;
+    size_t size_;
+    bool owner_;
+#ifdef _WIN32
+    HANDLE handle_;
+#endif
+};
+
+/** @brief The state of a node in a frame. */
+struct FrameNode {
+    /** @brief The index of the node in the name table of the segment. */
+    uint32_t node;
+    /** @brief The Node::State of the node. */
+    uint32_t state;
+};
+
+/** @brief The location of an entity in a frame. */
+struct FrameEntity {
+    /** @brief The entity id. */
+    uint32_t entity;
+    /** @brief The index of the node the entity is in. */
+    uint32_t node;
+    /** @brief The position of the front on a conveyor, negative elsewhere. */
+    float position;
+    /** @brief The length of the entity on a conveyor. */
+    float length;
+};
+
+/**
+ * @brief The layout of a frame segment.
+ *
+ * The segment starts with a header, followed by the node name table and a
+ * number of frame slots. Each slot is guarded by a seqlock: the sequence is
+ * odd while the slot is written and a reader that sees the same even
+ * sequence before and after reading the slot has read a consistent frame.
+ * The publisher rotates through the slots, so with three slots the frame
+ * announced as latest is not overwritten until two more frames have been
+ * published. A reader copies the slot before it checks the sequence and
+ * never uses data that has not been validated.
+ */
+namespace frame {
+
+constexpr char MAGIC[8] = { 'x', 's', 'i', 'm', 'f', 'r', 'm', '1' };
+
+struct SegmentHeader {
+    char magic[8];
+    uint32_t slot_count;
+    uint32_t max_nodes;
+    uint32_t max_entities;
+    uint32_t names_bytes;
+    uint64_t slot_bytes;
+    /** @brief The slot of the latest published frame. */
+    std::atomic<uint32_t> latest;
+};
+
+/**
+ * The fields of a slot are written while readers may read them, so they are
+ * atomics that both sides access relaxed, ordered by the sequence.
+ */
+struct SlotHeader {
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> frame;
+    std::atomic<simtime> time;
+    std::atomic<uint32_t> node_count;
+    std::atomic<uint32_t> entity_count;
+};
+
+// The segment is shared between processes, which only works for atomics
+// that do not fall back to a lock inside the object.
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<simtime>::is_always_lock_free,
+              "frame segments need lock free atomics");
+
+inline size_t align(size_t size)
+{
+    return (size + 63) & ~size_t(63);
+}
+
+inline size_t slot_bytes(uint32_t max_nodes, uint32_t max_entities)
+{
+    return align(sizeof(SlotHeader) + max_nodes * sizeof(FrameNode) + max_entities * sizeof(FrameEntity));
+}
+
+inline size_t names_offset()
+{
+    return align(sizeof(SegmentHeader));
+}
+
+inline size_t slot_offset(const SegmentHeader *header, uint32_t slot)
+{
+    return names_offset() + align(header->names_bytes) + slot * header->slot_bytes;
+}
+
+} // namespace frame
+
+/**
+ * @brief Writes animation frames into a shared memory segment.
+ *
+ * The simulation fills a frame at a fixed simulated time interval and
+ * publishes it without waiting for any viewer, a viewer process reads the
+ * frames with FrameReader. Nodes are referred to by index into a name table
+ * that is written once when the publisher is opened.
+ */
+class FramePublisher {
+public:
+    FramePublisher() : header_(nullptr), slot_(0), frame_(0), node_count_(0), entity_count_(0), interval_(1.0) {}
+
+    /**
+     * @brief Creates the segment.
+     *
+     * @param name         The name of the segment.
+     * @param node_names   The ids of the nodes, a frame refers to them by index.
+     * @param max_entities The maximum number of entities in a frame, the rest are dropped.
+     * @param slots        The number of frame slots, at least two.
+     *
+     * @returns True if the segment was created.
+     */
+    bool open(const std::string& name, const std::vector<std::string>& node_names,
+              uint32_t max_entities, uint32_t slots = 3)
+    {
+        std::string names;
+        for (const std::string& node : node_names)
+            names.append(node).push_back('\0');
+
+        uint32_t max_nodes = static_cast<uint32_t>(node_names.size());
+        size_t slot_bytes = frame::slot_bytes(max_nodes, max_entities);
+        size_t size = frame::names_offset() + frame::align(names.size()) + slots * slot_bytes;
+        if (slots < 2 || !segment_.open(name, size, true))
+            return false;
+
+        char *data = static_cast<char*>(segment_.data());
+        std::memset(data, 0, size);
+        header_ = new (data) frame::SegmentHeader();
+        std::memcpy(header_->magic, frame::MAGIC, sizeof(frame::MAGIC));
+        header_->slot_count = slots;
+        header_->max_nodes = max_nodes;
+        header_->max_entities = max_entities;
+        header_->names_bytes = static_cast<uint32_t>(names.size());
+        header_->slot_bytes = slot_bytes;
+        std::memcpy(data + frame::names_offset(), names.data(), names.size());
+        for (uint32_t slot = 0; slot < slots; ++slot)
+            new (data + frame::slot_offset(header_, slot)) frame::SlotHeader();
+        header_->latest.store(slots, std::memory_order_release);
+        slot_ = 0;
+        frame_ = 0;
+        return true;
+    }
+
+    /**
+     * @brief Closes the segment.
+     */
+    void close()
+    {
+        segment_.close();
+        header_ = nullptr;
+    }
+
+    bool is_open() const { return header_ != nullptr; }
+
+    /**
+     * @brief Sets the simulated time between frames.
+     *
+     * @param interval The interval in seconds.
+     */
+    void set_interval(simtime interval) { interval_ = interval; }
+    simtime interval() const { return interval_; }
+
+    /**
+     * @brief Starts writing a frame into the next slot.
+     *
+     * @param time The simulation time of the frame.
+     */
+    void begin_frame(simtime time)
+    {
+        slot_header_ = reinterpret_cast<frame::SlotHeader*>(
+            static_cast<char*>(segment_.data()) + frame::slot_offset(header_, slot_));
+        slot_header_->sequence.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot_header_->frame.store(frame_, std::memory_order_relaxed);
+        slot_header_->time.store(time, std::memory_order_relaxed);
+        node_count_ = 0;
+        entity_count_ = 0;
+    }
+
+    /**
+     * @brief Adds the state of a node to the frame.
+     *
+     * @param node  The index of the node in the name table.
+     * @param state The state.
+     */
+    void add_node(uint32_t node, uint32_t state)
+    {
+        if (node_count_ < header_->max_nodes)
+            nodes()[node_count_++] = FrameNode{ node, state };
+    }
+
+    /**
+     * @brief Adds the location of an entity to the frame.
+     */
+    void add_entity(uint32_t entity, uint32_t node, float position = -1.0f, float length = 0.0f)
+    {
+        if (entity_count_ < header_->max_entities)
+            entities()[entity_count_++] = FrameEntity{ entity, node, position, length };
+    }
+
+    /**
+     * @brief Finishes the frame and makes it the latest.
+     */
+    void publish()
+    {
+        slot_header_->node_count.store(node_count_, std::memory_order_relaxed);
+        slot_header_->entity_count.store(entity_count_, std::memory_order_relaxed);
+        slot_header_->sequence.fetch_add(1, std::memory_order_release);
+        header_->latest.store(slot_, std::memory_order_release);
+        slot_ = (slot_ + 1) % header_->slot_count;
+        ++frame_;
+    }
+
+    /**
+     * @returns The number of published frames.
+     */
+    uint64_t frames() const { return frame_; }
+
+private:
+    FrameNode* nodes() const
+    {
+        return reinterpret_cast<FrameNode*>(reinterpret_cast<char*>(slot_header_) + sizeof(frame::SlotHeader));
+    }
+
+    FrameEntity* entities() const
+    {
+        return reinterpret_cast<FrameEntity*>(nodes() + header_->max_nodes);
+    }
+
+    SharedMemorySegment segment_;
+    frame::SegmentHeader *header_;
+    frame::SlotHeader *slot_header_ = nullptr;
+    uint32_t slot_;
+    uint64_t frame_;
+    uint32_t node_count_;
+    uint32_t entity_count_;
+    simtime interval_;
+};
+
+/**
+ * @brief Reads animation frames from another process.
+ */
+class FrameReader {
+public:
+    /**
+     * @brief A frame copied from the segment.
+     */
+    struct Frame {
+        uint64_t frame = 0;
+        simtime time = 0;
+        std::vector<FrameNode> nodes;
+        std::vector<FrameEntity> entities;
+    };
+
+    FrameReader() : header_(nullptr) {}
+
+    /**
+     * @brief Opens a segment created by a FramePublisher.
+     *
+     * The layout in the header is checked against the size of the segment,
+     * so that a damaged or foreign segment is never read out of bounds.
+     *
+     * @param name The name of the segment.
+     *
+     * @returns True if the segment was opened.
+     */
+    bool open(const std::string& name)
+    {
+        header_ = nullptr;
+        if (!segment_.open(name, 0, false) || segment_.size() < frame::names_offset())
+            return false;
+        const frame::SegmentHeader *header = static_cast<const frame::SegmentHeader*>(segment_.data());
+        if (std::memcmp(header->magic, frame::MAGIC, sizeof(frame::MAGIC)) != 0 ||
+                header->slot_bytes < frame::slot_bytes(header->max_nodes, header->max_entities))
+            return false;
+        size_t slots = frame::names_offset() + frame::align(header->names_bytes);
+        if (slots > segment_.size() ||
+                header->slot_bytes > (segment_.size() - slots) / std::max<uint32_t>(header->slot_count, 1) ||
+                frame::slot_offset(header, header->slot_count) > segment_.size())
+            return false;
+        header_ = header;
+        return true;
+    }
+
+    /**
+     * @returns The node ids in name table order.
+     */
+    std::vector<std::string> node_names() const
+    {
+        std::vector<std::string> names;
+        const char *name = static_cast<const char*>(segment_.data()) + frame::names_offset();
+        const char *end = name + header_->names_bytes;
+        while (name < end) {
+            names.emplace_back(name);
+            name += names.back().size() + 1;
+        }
+        return names;
+    }
+
+    /**
+     * @brief Copies the latest frame.
+     *
+     * The slot is copied first and the copy is only used if the sequence of
+     * the slot did not change meanwhile, otherwise the publisher overwrote it
+     * and the frame should be read again.
+     *
+     * @param out Receives the frame, its buffers are reused.
+     *
+     * @returns True if a complete frame was copied.
+     */
+    bool latest(Frame& out) const
+    {
+        uint32_t slot = header_->latest.load(std::memory_order_acquire);
+        if (slot >= header_->slot_count)
+            return false;
+        const char *data = static_cast<const char*>(segment_.data()) + frame::slot_offset(header_, slot);
+        const frame::SlotHeader *header = reinterpret_cast<const frame::SlotHeader*>(data);
+        uint64_t sequence = header->sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+            return false;
+        uint64_t number = header->frame.load(std::memory_order_relaxed);
+        simtime time = header->time.load(std::memory_order_relaxed);
+        uint32_t node_count = std::min(header->node_count.load(std::memory_order_relaxed), header_->max_nodes);
+        uint32_t entity_count = std::min(header->entity_count.load(std::memory_order_relaxed), header_->max_entities);
+        const char *nodes = data + sizeof(frame::SlotHeader);
+        const char *entities = nodes + header_->max_nodes * sizeof(FrameNode);
+        out.nodes.resize(node_count);
+        out.entities.resize(entity_count);
+        std::memcpy(out.nodes.data(), nodes, node_count * sizeof(FrameNode));
+        std::memcpy(out.entities.data(), entities, entity_count * sizeof(FrameEntity));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->sequence.load(std::memory_order_relaxed) != sequence)
+            return false;
+        out.frame = number;
+        out.time = time;
+        return true;
+    }
+
+private:
+    SharedMemorySegment segment_;
+    const frame::SegmentHeader *header_;
+};
+
+} // namespace xsim
+
+#endif // FRAMEPUBLISHER_H
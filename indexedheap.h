@@ -0,0 +1,218 @@
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <xsim_config>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace xsim {
+
+/**
+ * @brief Extracts the identity of a heap value, the value itself.
+ */
+struct HeapIdentity {
+    template <typename T>
+    const T& operator()(const T& value) const { return value; }
+};
+
+/**
+ * @brief A binary heap that knows the position of each value.
+ *
+ * Values are identified by @p IdOf, so a value can be removed or its key
+ * changed in O(log n) without a search. The top is the value that @p Compare
+ * orders first, like std::list::sort and unlike std::priority_queue.
+ *
+ * @tparam T       The value type.
+ * @tparam Compare Strict weak ordering, true if the first value comes first.
+ * @tparam IdOf    Extracts a hashable identity from a value.
+ */
+template <typename T, typename Compare, typename IdOf = HeapIdentity>
+class IndexedHeap {
+public:
+    typedef typename std::decay<decltype(std::declval<IdOf>()(std::declval<const T&>()))>::type Id;
+
+    explicit IndexedHeap(const Compare& compare = Compare(), const IdOf& id_of = IdOf()) :
+        compare_(compare),
+        id_of_(id_of)
+    {}
+
+    /**
+     * @returns True if the heap is empty.
+     */
+    bool empty() const { return values_.empty(); }
+
+    /**
+     * @returns The number of values.
+     */
+    size_t size() const { return values_.size(); }
+
+    /**
+     * @param id The identity of a value.
+     *
+     * @returns True if a value with the identity is in the heap.
+     */
+    bool contains(const Id& id) const { return positions_.count(id) != 0; }
+
+    /**
+     * @returns The value that comes first, the heap must not be empty.
+     */
+    const T& top() const
+    {
+        assert(!values_.empty());
+        return values_.front();
+    }
+
+    /**
+     * @param id The identity of a value in the heap.
+     *
+     * @returns The value.
+     */
+    const T& get(const Id& id) const
+    {
+        return values_[positions_.at(id)];
+    }
+
+    /**
+     * @brief Adds a value, or replaces the value with the same identity.
+     *
+     * @param value The value.
+     */
+    void push(const T& value)
+    {
+        auto it = positions_.find(id_of_(value));
+        if (it != positions_.end()) {
+            size_t position = it->second;
+            values_[position] = value;
+            restore(position);
+            return;
+        }
+        values_.push_back(value);
+        positions_.emplace(id_of_(value), values_.size() - 1);
+        sift_up(values_.size() - 1);
+    }
+
+    /**
+     * @brief Removes the value that comes first.
+     */
+    void pop()
+    {
+        assert(!values_.empty());
+        remove_at(0);
+    }
+
+    /**
+     * @brief Removes a value.
+     *
+     * @param id The identity of the value.
+     *
+     * @returns True if the value was in the heap.
+     */
+    bool erase(const Id& id)
+    {
+        auto it = positions_.find(id);
+        if (it == positions_.end())
+            return false;
+        remove_at(it->second);
+        return true;
+    }
+
+    /**
+     * @brief Recomputes the order after the keys of many values changed.
+     *
+     * @param rekey Called with each value, may change the key of the value
+     *              but not its identity.
+     */
+    template <typename Rekey>
+    void rebuild(Rekey&& rekey)
+    {
+        for (T& value : values_)
+            rekey(value);
+        for (size_t i = values_.size() / 2; i-- > 0;)
+            sift_down(i);
+    }
+
+    /**
+     * @brief Removes all values.
+     */
+    void clear()
+    {
+        values_.clear();
+        positions_.clear();
+    }
+
+    /**
+     * @returns All values in heap order, which is not the sorted order.
+     */
+    const std::vector<T>& values() const { return values_; }
+
+private:
+    void remove_at(size_t position)
+    {
+        positions_.erase(id_of_(values_[position]));
+        size_t last = values_.size() - 1;
+        if (position != last) {
+            values_[position] = std::move(values_[last]);
+            positions_[id_of_(values_[position])] = position;
+        }
+        values_.pop_back();
+        if (position < values_.size())
+            restore(position);
+    }
+
+    void restore(size_t position)
+    {
+        if (position > 0 && compare_(values_[position], values_[(position - 1) / 2]))
+            sift_up(position);
+        else
+            sift_down(position);
+    }
+
+    void sift_up(size_t position)
+    {
+        while (position > 0) {
+            size_t parent = (position - 1) / 2;
+            if (!compare_(values_[position], values_[parent]))
+                break;
+            swap(position, parent);
+            position = parent;
+        }
+    }
+
+    void sift_down(size_t position)
+    {
+        size_t size = values_.size();
+        for (;;) {
+            size_t first = position;
+            size_t left = 2 * position + 1;
+            size_t right = left + 1;
+            if (left < size && compare_(values_[left], values_[first]))
+                first = left;
+            if (right < size && compare_(values_[right], values_[first]))
+                first = right;
+            if (first == position)
+                break;
+            swap(position, first);
+            position = first;
+        }
+    }
+
+    void swap(size_t a, size_t b)
+    {
+        std::swap(values_[a], values_[b]);
+        positions_[id_of_(values_[a])] = a;
+        positions_[id_of_(values_[b])] = b;
+    }
+
+    Compare compare_;
+    IdOf id_of_;
+    std::vector<T> values_;
+    std::unordered_map<Id, size_t> positions_;
+};
+
+} // namespace xsim
+
+#endif // INDEXEDHEAP_H
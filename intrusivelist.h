@@ -0,0 +1,253 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <xsim_config>
+#include <cassert>
+#include <cstddef>
+
+namespace xsim {
+
+template<typename Tag>
+class IntrusiveListBase;
+
+/**
+ * @brief Membership hook of an intrusive doubly-linked list.
+ *
+ * A class that should be stored in an IntrusiveList derives from a hook, one
+ * hook per list it can be a member of at the same time. The lists are told
+ * apart by the @p Tag type. A linked object unlinks itself when it is
+ * destroyed.
+ *
+ * @tparam Tag A type that identifies the list.
+ */
+template<typename Tag>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook() = default;
+
+    /** Copying and moving hooks is not supported. */
+    IntrusiveListHook(const IntrusiveListHook&) = delete;
+    IntrusiveListHook& operator=(const IntrusiveListHook&) = delete;
+
+    ~IntrusiveListHook()
+    {
+        unlink();
+    }
+
+    /**
+     * @returns True if the hook is linked into a list.
+     */
+    bool is_linked() const
+    {
+        return owner_ != nullptr;
+    }
+
+    /**
+     * @brief Removes the hook from the list it is linked into, if any.
+     */
+    void unlink()
+    {
+        if (owner_)
+            owner_->erase(this);
+    }
+
+private:
+    friend class IntrusiveListBase<Tag>;
+
+    IntrusiveListHook* prev_ = nullptr;
+    IntrusiveListHook* next_ = nullptr;
+    IntrusiveListBase<Tag>* owner_ = nullptr;
+};
+
+/**
+ * @brief The type independent part of IntrusiveList.
+ */
+template<typename Tag>
+class IntrusiveListBase {
+public:
+    typedef IntrusiveListHook<Tag> Hook;
+
+    IntrusiveListBase() = default;
+
+    /** Copying and moving lists is not supported. */
+    IntrusiveListBase(const IntrusiveListBase&) = delete;
+    IntrusiveListBase& operator=(const IntrusiveListBase&) = delete;
+
+    ~IntrusiveListBase()
+    {
+        clear();
+    }
+
+    /**
+     * @returns True if the list is empty.
+     */
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @returns The number of linked objects.
+     */
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Unlinks all objects, the objects themselves are not deleted.
+     */
+    void clear()
+    {
+        while (head_)
+            erase(head_);
+    }
+
+protected:
+    friend class IntrusiveListHook<Tag>;
+
+    void link_back(Hook* hook)
+    {
+        if (hook->owner_)
+            hook->owner_->erase(hook);
+
+        hook->owner_ = this;
+        hook->prev_ = tail_;
+        hook->next_ = nullptr;
+        if (tail_)
+            tail_->next_ = hook;
+        else
+            head_ = hook;
+        tail_ = hook;
+        ++size_;
+    }
+
+    void erase(Hook* hook)
+    {
+        assert(hook->owner_ == this);
+        if (hook->prev_)
+            hook->prev_->next_ = hook->next_;
+        else
+            head_ = hook->next_;
+        if (hook->next_)
+            hook->next_->prev_ = hook->prev_;
+        else
+            tail_ = hook->prev_;
+        hook->prev_ = nullptr;
+        hook->next_ = nullptr;
+        hook->owner_ = nullptr;
+        --size_;
+    }
+
+    static Hook* next(const Hook* hook)
+    {
+        return hook->next_;
+    }
+
+    static bool is_owned_by(const Hook* hook, const IntrusiveListBase* list)
+    {
+        return hook->owner_ == list;
+    }
+
+    Hook* head_ = nullptr;
+    Hook* tail_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief A doubly-linked list that stores its links in the objects.
+ *
+ * Adding and removing objects is O(1) and never allocates. An object can only
+ * be linked into one list per @p Tag at a time, linking it into another list
+ * moves it.
+ *
+ * @tparam T   The object type, must derive from IntrusiveListHook<Tag>.
+ * @tparam Tag A type that identifies the list.
+ */
+template<typename T, typename Tag>
+class IntrusiveList : public IntrusiveListBase<Tag> {
+    typedef IntrusiveListBase<Tag> Base;
+    typedef typename Base::Hook Hook;
+
+public:
+    /**
+     * @brief Forward iterator.
+     *
+     * The iterator reads the next link before the current object is returned,
+     * so the current object may be unlinked or deleted while iterating.
+     */
+    class iterator {
+    public:
+        explicit iterator(Hook* hook) :
+            current_(hook),
+            next_(hook ? Base::next(hook) : nullptr)
+        {}
+
+        T* operator*() const { return static_cast<T*>(current_); }
+
+        iterator& operator++()
+        {
+            current_ = next_;
+            next_ = current_ ? Base::next(current_) : nullptr;
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return current_ == other.current_; }
+        bool operator!=(const iterator& other) const { return current_ != other.current_; }
+
+    private:
+        Hook* current_;
+        Hook* next_;
+    };
+
+    iterator begin() const { return iterator(this->head_); }
+    iterator end() const { return iterator(nullptr); }
+
+    /**
+     * @returns The first object, or nullptr if the list is empty.
+     */
+    T* front() const
+    {
+        return this->head_ ? static_cast<T*>(this->head_) : nullptr;
+    }
+
+    /**
+     * @brief Links an object at the end of the list.
+     *
+     * @param object The object to link.
+     */
+    void push_back(T* object)
+    {
+        this->link_back(static_cast<Hook*>(object));
+    }
+
+    /**
+     * @brief Unlinks an object if it is a member of this list.
+     *
+     * @param object The object to unlink.
+     *
+     * @returns True if the object was unlinked.
+     */
+    bool remove(T* object)
+    {
+        Hook* hook = static_cast<Hook*>(object);
+        if (!Base::is_owned_by(hook, this))
+            return false;
+        this->erase(hook);
+        return true;
+    }
+
+    /**
+     * @param object The object to search for.
+     *
+     * @returns True if the object is a member of this list.
+     */
+    bool contains(const T* object) const
+    {
+        return Base::is_owned_by(static_cast<const Hook*>(object), this);
+    }
+};
+
+} // namespace xsim
+
+#endif // INTRUSIVELIST_H
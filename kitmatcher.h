@@ -0,0 +1,289 @@
+#ifndef KITMATCHER_H
+#define KITMATCHER_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "variantmap.h"
+
+namespace xsim {
+
+class AssemblySpecification;
+
+/**
+ * @brief Tracks what the open kits of an Assembly still need.
+ *
+ * A kit is an assembly specification together with the parts that have
+ * arrived for it. Each kit keeps its outstanding need per variant and a
+ * completion counter, the number of parts, units and containers it still
+ * misses. Over the active kits each variant keeps the outstanding needs in
+ * an ordered count map, so whether a variant is needed by any active kit and
+ * the largest need of any active kit are O(1), and an arrival is O(log k)
+ * in the number of distinct needs, instead of a walk over the active
+ * specifications and their parts.
+ */
+class KitMatcher {
+public:
+    KitMatcher() = default;
+
+    /**
+     * @brief Adds a kit, inactive and with nothing required.
+     *
+     * @param spec The assembly specification of the kit.
+     *
+     * @returns The index of the kit.
+     */
+    size_t add(AssemblySpecification *spec)
+    {
+        kits_.emplace_back();
+        kits_.back().spec = spec;
+        return kits_.size() - 1;
+    }
+
+    /**
+     * @brief Sets what a kit requires, used when the kit is reset.
+     *
+     * @param kit       The index of the kit.
+     * @param variant   The variant.
+     * @param count     The number of parts or units of the variant.
+     */
+    void require(size_t kit, Variant *variant, int count)
+    {
+        kits_[kit].required[variant] = count;
+    }
+
+    /**
+     * @brief Sets how many parts of any variant a kit requires.
+     */
+    void require_untyped(size_t kit, int count) { kits_[kit].required_untyped = count; }
+
+    /**
+     * @brief Sets if a kit requires a container.
+     */
+    void require_container(size_t kit, bool value) { kits_[kit].required_container = value; }
+
+    /**
+     * @brief Restores the needs of a kit to what it requires and activates it.
+     *
+     * @param kit The index of the kit.
+     */
+    void reset(size_t kit)
+    {
+        deactivate(kit);
+        Kit& entry = kits_[kit];
+        entry.needs.clear();
+        entry.outstanding = 0;
+        for (const auto& required : entry.required) {
+            entry.needs[required.first] = required.second;
+            entry.outstanding += required.second;
+        }
+        entry.untyped = entry.required_untyped;
+        entry.outstanding += entry.untyped;
+        entry.container = entry.required_container;
+        entry.outstanding += entry.container ? 1 : 0;
+        activate(kit);
+    }
+
+    /**
+     * @brief Makes a kit take part in the aggregated needs.
+     *
+     * @param kit The index of the kit.
+     */
+    void activate(size_t kit)
+    {
+        Kit& entry = kits_[kit];
+        if (entry.active)
+            return;
+        entry.active = true;
+        for (const auto& need : entry.needs)
+            add_level(need.first, need.second);
+        if (entry.untyped > 0)
+            ++untyped_kits_;
+        if (entry.outstanding == 0)
+            ++complete_kits_;
+    }
+
+    /**
+     * @brief Removes a kit from the aggregated needs, used when the
+     * assembly drops a specification that does not fit the parts that
+     * arrived.
+     *
+     * @param kit The index of the kit.
+     */
+    void deactivate(size_t kit)
+    {
+        Kit& entry = kits_[kit];
+        if (!entry.active)
+            return;
+        entry.active = false;
+        for (const auto& need : entry.needs)
+            remove_level(need.first, need.second);
+        if (entry.untyped > 0)
+            --untyped_kits_;
+        if (entry.outstanding == 0)
+            --complete_kits_;
+    }
+
+    /**
+     * @brief Records parts or units that arrived for a kit.
+     *
+     * @param kit     The index of the kit.
+     * @param variant The variant.
+     * @param count   The number of parts or units.
+     *
+     * @returns The number that the kit took, the rest is not needed by it.
+     */
+    int receive(size_t kit, Variant *variant, int count)
+    {
+        Kit& entry = kits_[kit];
+        int *need = entry.needs.find(variant);
+        int taken = 0;
+        if (need && *need > 0) {
+            taken = *need < count ? *need : count;
+            if (entry.active) {
+                remove_level(variant, *need);
+                add_level(variant, *need - taken);
+            }
+            *need -= taken;
+        }
+        if (taken < count && entry.untyped > 0) {
+            int untyped = entry.untyped < count - taken ? entry.untyped : count - taken;
+            entry.untyped -= untyped;
+            taken += untyped;
+            if (entry.active && entry.untyped == 0)
+                --untyped_kits_;
+        }
+        complete(entry, taken);
+        return taken;
+    }
+
+    /**
+     * @brief Records that the container of a kit arrived.
+     *
+     * @param kit The index of the kit.
+     */
+    void receive_container(size_t kit)
+    {
+        Kit& entry = kits_[kit];
+        if (!entry.container)
+            return;
+        entry.container = false;
+        complete(entry, 1);
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns True if any active kit needs the variant.
+     */
+    bool is_needed(Variant *variant) const
+    {
+        return untyped_kits_ > 0 || max_need(variant) > 0;
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The largest outstanding need of the variant in any active kit,
+     * not counting parts of any variant.
+     */
+    int max_need(Variant *variant) const
+    {
+        const Levels *levels = levels_.find(variant);
+        return levels && !levels->empty() ? levels->rbegin()->first : 0;
+    }
+
+    /**
+     * @param kit The index of the kit.
+     *
+     * @returns The number of parts, units and containers the kit still misses.
+     */
+    int outstanding(size_t kit) const { return kits_[kit].outstanding; }
+
+    /**
+     * @param kit The index of the kit.
+     *
+     * @returns True if the kit misses nothing.
+     */
+    bool is_complete(size_t kit) const { return kits_[kit].outstanding == 0; }
+
+    /**
+     * @returns True if any active kit is complete.
+     */
+    bool any_complete() const { return complete_kits_ > 0; }
+
+    /**
+     * @param kit The index of the kit.
+     *
+     * @returns The assembly specification of the kit.
+     */
+    AssemblySpecification* spec(size_t kit) const { return kits_[kit].spec; }
+
+    /**
+     * @returns The number of kits.
+     */
+    size_t size() const { return kits_.size(); }
+
+    /**
+     * @brief Removes all kits.
+     */
+    void clear()
+    {
+        kits_.clear();
+        levels_.clear();
+        untyped_kits_ = 0;
+        complete_kits_ = 0;
+    }
+
+private:
+    struct Kit {
+        AssemblySpecification *spec = nullptr;
+        bool active = false;
+        VariantMap<int> required;
+        int required_untyped = 0;
+        bool required_container = false;
+        VariantMap<int> needs;
+        int untyped = 0;
+        bool container = false;
+        int outstanding = 0;
+    };
+
+    /** @brief The number of active kits per outstanding need of a variant. */
+    typedef std::map<int, size_t> Levels;
+
+    void add_level(Variant *variant, int need)
+    {
+        if (need > 0)
+            ++levels_[variant][need];
+    }
+
+    void remove_level(Variant *variant, int need)
+    {
+        if (need <= 0)
+            return;
+        Levels& levels = levels_[variant];
+        auto it = levels.find(need);
+        if (--it->second == 0)
+            levels.erase(it);
+    }
+
+    void complete(Kit& entry, int count)
+    {
+        if (count == 0)
+            return;
+        entry.outstanding -= count;
+        if (entry.active && entry.outstanding == 0)
+            ++complete_kits_;
+    }
+
+    std::vector<Kit> kits_;
+    VariantMap<Levels> levels_;
+    size_t untyped_kits_ = 0;
+    size_t complete_kits_ = 0;
+};
+
+} // namespace xsim
+
+#endif // KITMATCHER_H
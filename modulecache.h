@@ -0,0 +1,423 @@
+#ifndef MODULECACHE_H
+#define MODULECACHE_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace xsim {
+
+/**
+ * @brief An on-disk cache of compiled user modules.
+ *
+ * Compiled module objects are stored under a key that is a hash of everything
+ * that affects the compilation: the module source, the headers it can see,
+ * the compiler flags, the LLVM version, the target triple and CPU, the xsim
+ * build id and the contents of the xsim public headers. A changed input gives
+ * a new key, so stale objects are never returned and no explicit invalidation
+ * is needed.
+ *
+ * The cache can be shared by many processes. Objects are written to a unique
+ * temporary file and renamed into place, so a reader either finds a complete
+ * object or nothing. Each object carries a header with its key and size that
+ * is verified when it is read, a damaged object is treated as a miss.
+ * Temporary files left behind by writers that died are removed by prune().
+ */
+class ModuleCache {
+public:
+    /** @brief The age after which prune() removes a temporary file. */
+    static constexpr std::chrono::hours TEMPORARY_AGE{ 1 };
+
+    /**
+     * @brief Builds a cache key.
+     *
+     * The key is 128 bits from two independent 64 bit lanes: FNV-1a and a
+     * multiplicative hash with a different multiplier, each passed through a
+     * final avalanche so that every input bit affects every key bit.
+     */
+    class KeyBuilder {
+    public:
+        KeyBuilder() : a_(0xcbf29ce484222325ull), b_(0x6a09e667f3bcc909ull) {}
+
+        /**
+         * @brief Adds an input to the key.
+         *
+         * Inputs are length prefixed, so the key depends on how the data is
+         * split into inputs and not only on the concatenated bytes.
+         *
+         * @param data The input.
+         *
+         * @returns This builder.
+         */
+        KeyBuilder& add(std::string_view data)
+        {
+            uint64_t size = data.size();
+            mix(reinterpret_cast<const char*>(&size), sizeof(size));
+            mix(data.data(), data.size());
+            return *this;
+        }
+
+        /**
+         * @returns The key as 32 hexadecimal characters.
+         */
+        std::string key() const
+        {
+            static const char digits[] = "0123456789abcdef";
+            uint64_t a = finalize(a_);
+            uint64_t b = finalize(b_ ^ a);
+            std::string key(32, '0');
+            for (int i = 0; i < 16; ++i) {
+                key[15 - i] = digits[(a >> (i * 4)) & 0xf];
+                key[31 - i] = digits[(b >> (i * 4)) & 0xf];
+            }
+            return key;
+        }
+
+    private:
+        void mix(const char* data, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i) {
+                uint8_t byte = static_cast<uint8_t>(data[i]);
+                a_ = (a_ ^ byte) * 0x100000001b3ull;
+                b_ = (b_ + byte + 1) * 0x9e3779b97f4a7c15ull;
+                b_ ^= b_ >> 32;
+            }
+        }
+
+        static uint64_t finalize(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        uint64_t a_;
+        uint64_t b_;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param directory The cache directory, created if it does not exist. An
+     *                  empty directory disables the cache.
+     */
+    explicit ModuleCache(const std::string& directory = std::string()) :
+        hits_(0),
+        misses_(0)
+    {
+        set_directory(directory);
+    }
+
+    /**
+     * @brief Sets the cache directory.
+     *
+     * The first time a directory is set, the xsim public headers next to this
+     * header are digested into every key unless set_include_directory() was
+     * called before.
+     *
+     * @param directory The cache directory, created if it does not exist. An
+     *                  empty directory disables the cache.
+     */
+    void set_directory(const std::string& directory)
+    {
+        directory_ = directory;
+        if (!directory_.empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(directory_, ec);
+            if (ec)
+                directory_.clear();
+        }
+        if (!directory_.empty() && include_digest_.empty())
+            set_include_directory(std::filesystem::path(__FILE__).parent_path().string());
+    }
+
+    /**
+     * @brief Sets the compiler that produces the cached objects, it becomes
+     *        part of every key.
+     *
+     * The cache stays disabled until this is called, so that objects compiled
+     * by another LLVM version or for another machine are never returned.
+     *
+     * @param llvm_version The LLVM version, as LLVM_VERSION_STRING.
+     * @param triple       The target triple.
+     * @param cpu          The target CPU name and features.
+     */
+    void set_target(const std::string& llvm_version, const std::string& triple, const std::string& cpu)
+    {
+        target_ = KeyBuilder().add(llvm_version).add(triple).add(cpu).key();
+    }
+
+    /**
+     * @returns True if the cache has a usable directory and a target.
+     */
+    bool enabled() const { return !directory_.empty() && !target_.empty(); }
+
+    /**
+     * @brief Sets the directory of the xsim public headers that modules are
+     *        compiled against, their contents become part of every key.
+     *
+     * Defaults to the directory of this header, set it when the modules are
+     * compiled against headers installed elsewhere. Without a readable
+     * directory only XSIM_BUILD_ID identifies the headers.
+     *
+     * @param directory The include directory.
+     *
+     * @returns False if the directory could not be read.
+     */
+    bool set_include_directory(const std::string& directory)
+    {
+        std::vector<std::filesystem::path> paths;
+        std::error_code ec;
+        for (const auto& item : std::filesystem::directory_iterator(directory, ec)) {
+            std::filesystem::path path = item.path();
+            if (path.extension() == ".h" || path.extension() == ".hpp" || path.filename() == "xsim_config")
+                paths.push_back(path);
+        }
+        if (ec)
+            return false;
+        std::sort(paths.begin(), paths.end());
+
+        KeyBuilder builder;
+        for (const std::filesystem::path& path : paths) {
+            std::ifstream file(path, std::ios::binary);
+            std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            if (!file && !file.eof())
+                return false;
+            builder.add(path.filename().string()).add(contents);
+        }
+        include_digest_ = builder.key();
+        return true;
+    }
+
+    /**
+     * @brief Builds the key of a module.
+     *
+     * @param source  The module source.
+     * @param headers The contents of the headers the module can include.
+     * @param flags   The compiler flags.
+     *
+     * @returns The key.
+     */
+    std::string key(const std::string& source,
+                    const std::vector<std::string>& headers,
+                    const std::string& flags) const
+    {
+        KeyBuilder builder;
+        builder.add(XSIM_BUILD_ID).add(include_digest_).add(target_).add(flags).add(source);
+        for (const std::string& header : headers)
+            builder.add(header);
+        return builder.key();
+    }
+
+    /**
+     * @brief Looks up a compiled module object.
+     *
+     * @param key    The key of the module.
+     * @param object Receives the object on a hit.
+     *
+     * @returns True on a hit.
+     */
+    bool lookup(const std::string& key, std::vector<char>& object)
+    {
+        if (!enabled()) {
+            ++misses_;
+            return false;
+        }
+
+        std::filesystem::path path = object_path(key);
+        std::ifstream file(path, std::ios::binary);
+        Header header;
+        if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+                std::memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 ||
+                std::string_view(header.key, strnlen(header.key, sizeof(header.key))) != key) {
+            ++misses_;
+            return false;
+        }
+
+        // The size in the header is only trusted if it matches the file.
+        std::error_code ec;
+        uintmax_t file_size = std::filesystem::file_size(path, ec);
+        if (ec || file_size < sizeof(header) || header.size != file_size - sizeof(header) ||
+                !read_object(file, header.size, object)) {
+            file.close();
+            std::filesystem::remove(path, ec);
+            ++misses_;
+            return false;
+        }
+
+        // Touch the object so pruning removes the least recently used ones.
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+        ++hits_;
+        return true;
+    }
+
+    /**
+     * @brief Stores a compiled module object.
+     *
+     * Safe to call concurrently from many processes, the last complete write
+     * of a key wins and all writes of a key have the same contents.
+     *
+     * @param key    The key of the module.
+     * @param object The compiled object.
+     *
+     * @returns True if the object was stored.
+     */
+    bool store(const std::string& key, const std::vector<char>& object)
+    {
+        if (!enabled() || key.size() >= sizeof(Header::key))
+            return false;
+
+        Header header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+        std::memcpy(header.key, key.data(), key.size());
+        header.size = object.size();
+
+        std::filesystem::path path = object_path(key);
+        std::filesystem::path temporary = path;
+        temporary += "." + unique_suffix() + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+                    !file.write(object.data(), object.size())) {
+                file.close();
+                std::error_code ec;
+                std::filesystem::remove(temporary, ec);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temporary, path, ec);
+        if (ec) {
+            // Another process may have won the race, which is as good.
+            std::filesystem::remove(temporary, ec);
+            return std::filesystem::exists(path, ec);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the least recently used objects until the cache is
+     *        within a size limit.
+     *
+     * Temporary files that have not been written for TEMPORARY_AGE are left
+     * behind by writers that died and are removed as well.
+     *
+     * @param max_bytes The size limit.
+     *
+     * @returns The number of removed objects.
+     */
+    size_t prune(uintmax_t max_bytes)
+    {
+        if (!enabled())
+            return 0;
+
+        struct Entry {
+            std::filesystem::path path;
+            std::filesystem::file_time_type time;
+            uintmax_t size;
+        };
+        std::vector<Entry> entries;
+        uintmax_t total = 0;
+        std::error_code ec;
+        auto stale = std::filesystem::file_time_type::clock::now() - TEMPORARY_AGE;
+        for (const auto& item : std::filesystem::directory_iterator(directory_, ec)) {
+            if (item.path().extension() == ".tmp") {
+                auto time = item.last_write_time(ec);
+                if (!ec && time < stale)
+                    std::filesystem::remove(item.path(), ec);
+                continue;
+            }
+            if (item.path().extension() != ".obj")
+                continue;
+            Entry entry{ item.path(), item.last_write_time(ec), item.file_size(ec) };
+            if (ec)
+                continue;
+            total += entry.size;
+            entries.push_back(entry);
+        }
+
+        std::sort(entries.begin(), entries.end(),
+                  [](const Entry& lhs, const Entry& rhs) { return lhs.time < rhs.time; });
+
+        size_t removed = 0;
+        for (const Entry& entry : entries) {
+            if (total <= max_bytes)
+                break;
+            if (std::filesystem::remove(entry.path, ec)) {
+                total -= entry.size;
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @returns The number of lookups that found an object.
+     */
+    size_t hits() const { return hits_; }
+
+    /**
+     * @returns The number of lookups that did not find an object.
+     */
+    size_t misses() const { return misses_; }
+
+private:
+    struct Header {
+        char magic[8];
+        char key[40];
+        uint64_t size;
+    };
+
+    static constexpr char MAGIC[8] = { 'x', 's', 'i', 'm', 'o', 'b', 'j', '1' };
+
+    static bool read_object(std::ifstream& file, uint64_t size, std::vector<char>& object)
+    {
+        object.resize(static_cast<size_t>(size));
+        return file.read(object.data(), object.size()) && file.peek() == std::ifstream::traits_type::eof();
+    }
+
+    std::filesystem::path object_path(const std::string& key) const
+    {
+        return std::filesystem::path(directory_) / (key + ".obj");
+    }
+
+    static std::string unique_suffix()
+    {
+        static std::atomic<unsigned> counter(0);
+        static const uint64_t process = std::random_device()() ^
+            static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        KeyBuilder builder;
+        builder.add(std::to_string(process)).add(std::to_string(counter++));
+        return builder.key().substr(0, 16);
+    }
+
+    std::string directory_;
+
+    /** @brief The digest of the xsim public headers, see set_include_directory. */
+    std::string include_digest_;
+
+    /** @brief The digest of the compiler and target, see set_target. */
+    std::string target_;
+
+    size_t hits_;
+    size_t misses_;
+};
+
+} // namespace xsim
+
+#endif // MODULECACHE_H
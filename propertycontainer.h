@@ -1,282 +1,535 @@
-﻿#ifndef PROPERTYCONTAINER_H
-#define PROPERTYCONTAINER_H
-
-#include <xsim_config>
-#include <any>
-#include <string>
-#include <sstream>
-#include <map>
-#include <variant>
-#include <functional>
-
-namespace xsim {
-
-/**
- * @brief A PropertyContainer store properties as key / value pairs that can be manipulated at
- *        runtime.
- */
-class XSIM_EXPORT PropertyContainer {
- public:
-     typedef std::variant<std::string, int, void*> PropertyKey;
-
-     /**
-      * @brief Delete all properties.
-      *
-      */
-    void clear();
-
-     /**
-      * @brief Copies all properties to another property container.
-      *
-      * @param[in] properties The property container to copy properties to.
-      */
-     void copy(PropertyContainer *properties) const;
-
-     /**
-      * @brief Remove a property on the object.
-      *
-      * @param[in] key The property key to remove.
-      */
-     template <typename V>
-     void remove(const PropertyKey& key)
-     {
-         auto&& i = properties_.find(key);
-         if (i != properties_.end())
-             properties_.erase(i);
-     }
-     template<>
-     void remove<double>(const PropertyKey& key)
-     {
-         auto&& i = double_properties_.find(key);
-         if (i != double_properties_.end())
-             double_properties_.erase(i);
-     }
-     template<>
-     void remove<int>(const PropertyKey& key)
-     {
-         auto&& i = int_properties_.find(key);
-         if (i != int_properties_.end())
-             int_properties_.erase(i);
-     }
-
-     /**
-      * @brief Returns true if a property has been set.
-      *
-      * @param[in] key The property key to look for.
-      *
-      * @return True if the property exists.
-      */
-     template <typename V>
-     bool has(const PropertyKey& key)
-     {
-         return properties_.find(key) != properties_.end();
-     }
-     template<>
-     bool has<double>(const PropertyKey& key)
-     {
-         return double_properties_.find(key) != double_properties_.end();
-     }
-     template<>
-     bool has<int>(const PropertyKey& key)
-     {
-         return int_properties_.find(key) != int_properties_.end();
-     }
-
-     /**
-      * @brief Set a property on the object.
-      *
-      * @param key The name of the property.
-      * @param value A value to store on the object.
-      */
-     template <typename V>
-     void set(const PropertyKey& key, const V& value)
-     {
-         properties_[key] = value;
-     }
-     template<>
-     void set<double>(const PropertyKey& key, const double& value)
-     {
-         double_properties_[key] = value;
-     }
-     template<>
-     void set<int>(const PropertyKey& key, const int& value)
-     {
-         int_properties_[key] = value;
-     }
-
-     /**
-      * @brief Attempts to update a property using a supplied function.
-      *
-      * @param[in] key The name of the property to update.
-      * @param  func The function used to update the property.
-      *
-      * @returns True if the property exists, false otherwise.
-      */
-     template <typename V>
-     bool try_update(const PropertyKey& key, std::function<V (const V&)> func)
-     {
-         auto&& i = properties_.find(key);
-         if (i == properties_.end())
-             return false;
-         i->second = func(std::any_cast<V>(i->second));
-         return true;
-     }
-     template<>
-     bool try_update<double>(const PropertyKey& key, std::function<double (const double&)> func)
-     {
-         auto&& i = double_properties_.find(key);
-         if (i == double_properties_.end())
-             return false;
-         i->second = func(i->second);
-         return true;
-     }
-     template<>
-     bool try_update<int>(const PropertyKey& key, std::function<int (const int&)> func)
-     {
-         auto&& i = int_properties_.find(key);
-         if (i == int_properties_.end())
-             return false;
-         i->second = func(i->second);
-         return true;
-     }
-
-     /**
-      * @brief Get a property on the object.
-      *
-      * @param[in] key The name of the property to retrieve.
-      * @param[out] value The value stored on the the object.
-      *
-      * @return True if property exists.
-      */
-     template <typename V>
-     bool try_get(const PropertyKey& key, V& value) const
-     {
-         auto&& i = properties_.find(key);
-         if (i == properties_.end())
-             return false;
-
-         value = std::any_cast<V>(i->second);
-         return true;
-     }
-     template<>
-     bool try_get<double>(const PropertyKey& key, double& value) const
-     {
-         auto&& i = double_properties_.find(key);
-         if (i == double_properties_.end())
-             return false;
-
-         value = i->second;
-         return true;
-     }
-     template<>
-     bool try_get<int>(const PropertyKey& key, int& value) const
-     {
-         auto&& i = int_properties_.find(key);
-         if (i == int_properties_.end())
-             return false;
-
-         value = i->second;
-         return true;
-     }
-
-     /**
-      * @brief Get a property on the object.
-      *
-      * @param[in] key The name of the property to retrieve.
-      *
-      * @return The value stored on the the object.
-      */
-     template<typename V>
-     V get(const PropertyKey& key) const
-     {
-         auto&& p = properties_.find(key);
-         if (p == properties_.end()) {
-             std::stringstream ss;
-             std::string name = std::visit([](auto&& arg) -> std::string {
-                 using C = std::decay_t<decltype(arg)>;
-                 if constexpr (std::is_same_v<C, std::string>) {
-                     return arg;
-                 }
-                 else if constexpr (std::is_same_v<C, int>) {
-                     return std::to_string(arg);
-                 }
-                 else if constexpr (std::is_same_v<C, void*>) {
-                     std::stringstream ss;
-                     ss << arg;
-                     return ss.str();
-                 }
-                 else {
-                     return "";
-                 }
-             }, key);
-             throw std::runtime_error("Property does not exist: " + name);
-         }
-
-         return std::any_cast<V>(p->second);
-     }
-     template<>
-     double get<double>(const PropertyKey& key) const
-     {
-         auto&& p = double_properties_.find(key);
-         if (p == double_properties_.end()) {
-             std::stringstream ss;
-             std::string name = std::visit([](auto&& arg) -> std::string {
-                 using C = std::decay_t<decltype(arg)>;
-                 if constexpr (std::is_same_v<C, std::string>) {
-                     return arg;
-                 }
-                 else if constexpr (std::is_same_v<C, int>) {
-                     return std::to_string(arg);
-                 }
-                 else if constexpr (std::is_same_v<C, void*>) {
-                     std::stringstream ss;
-                     ss << arg;
-                     return ss.str();
-                 }
-                 else {
-                     return "";
-                 }
-             }, key);
-             throw std::runtime_error("Property does not exist: " + name);
-         }
-
-         return p->second;
-     }
-     template<>
-     int get<int>(const PropertyKey& key) const
-     {
-         auto&& p = int_properties_.find(key);
-         if (p == int_properties_.end()) {
-             std::stringstream ss;
-             std::string name = std::visit([](auto&& arg) -> std::string {
-                 using C = std::decay_t<decltype(arg)>;
-                 if constexpr (std::is_same_v<C, std::string>) {
-                     return arg;
-                 }
-                 else if constexpr (std::is_same_v<C, int>) {
-                     return std::to_string(arg);
-                 }
-                 else if constexpr (std::is_same_v<C, void*>) {
-                     std::stringstream ss;
-                     ss << arg;
-                     return ss.str();
-                 }
-                 else {
-                     return "";
-                 }
-             }, key);
-             throw std::runtime_error("Property does not exist: " + name);
-         }
-
-         return p->second;
-     }
-
-private:
-    std::map<PropertyKey, std::any> properties_;
-    std::map<PropertyKey, double> double_properties_;
-    std::map<PropertyKey, int> int_properties_;
-};
-
-} // namespace xsim
-
-#endif // PROPERTYCONTAINER_H
+﻿#ifndef PROPERTYCONTAINER_H
+#define PROPERTYCONTAINER_H
+
+#include <xsim_config>
+#include <any>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <map>
+#include <memory>
+#include <variant>
+#include <functional>
+
+#include "propertyschema.h"
+
+namespace xsim {
+
+/**
+ * @brief A PropertyContainer store properties as key / value pairs that can be manipulated at
+ *        runtime.
+ *
+ * A container can be bound to a PropertySchema, the declared properties are then stored in flat
+ * slots that are shared with the schema defaults until they are written. Properties that are not
+ * declared in the schema are stored by key.
+ *
+ * Accessing a declared property by key behaves as for any other property, it exists once it has
+ * been set and until it is removed. Accessing it through a handle returns the schema default
+ * until it is set.
+ */
+class XSIM_EXPORT PropertyContainer {
+ public:
+     typedef xsim::PropertyKey PropertyKey;
+
+     /**
+      * @brief Delete all properties.
+      *
+      */
+    void clear();
+
+     /**
+      * @brief Copies all properties to another property container.
+      *
+      * The schema slots are shared with the other container and copied on the first write.
+      *
+      * @param[in] properties The property container to copy properties to.
+      */
+     void copy(PropertyContainer *properties) const;
+
+     /**
+      * @brief Binds the container to a schema.
+      *
+      * Any values previously stored in schema slots are replaced by the schema defaults.
+      *
+      * @param schema The schema, or nullptr to store all properties by key.
+      */
+     void set_schema(const PropertySchema *schema)
+     {
+         schema_ = schema;
+         values_ = schema ? schema->defaults() : nullptr;
+     }
+
+     /**
+      * @return The schema the container is bound to, or nullptr if none.
+      */
+     const PropertySchema* schema() const { return schema_; }
+
+     /**
+      * @brief Get a property through a handle resolved in the schema.
+      *
+      * @param handle The handle to the property, resolved in the schema of this container.
+      *
+      * @return The value stored on the the object, or the schema default.
+      *
+      * @throws std::runtime_error If the handle was not resolved in the schema of this container.
+      */
+     template <typename V>
+     V get(PropertyHandle<V> handle) const
+     {
+         check(handle);
+         const auto& slots = values_->slots<V>();
+         const PropertyValues& values = handle.index() < slots.size() ? *values_ : *schema_->defaults();
+         if constexpr (std::is_same_v<V, double> || std::is_same_v<V, int>)
+             return values.slots<V>()[handle.index()];
+         else
+             return std::any_cast<V>(values.values[handle.index()]);
+     }
+
+     /**
+      * @brief Set a property through a handle resolved in the schema.
+      *
+      * @param handle The handle to the property, resolved in the schema of this container.
+      * @param value A value to store on the object.
+      *
+      * @throws std::runtime_error If the handle was not resolved in the schema of this container.
+      */
+     template <typename V>
+     void set(PropertyHandle<V> handle, const V& value)
+     {
+         check(handle);
+         PropertyValues& values = writable_values();
+         values.slots<V>()[handle.index()] = value;
+         values.set_flags<V>()[handle.index()] = true;
+     }
+
+     /**
+      * @brief Update a property through a handle resolved in the schema.
+      *
+      * @param handle The handle to the property, resolved in the schema of this container.
+      * @param func The function used to update the property.
+      */
+     template <typename V>
+     void update(PropertyHandle<V> handle, std::function<V (const V&)> func)
+     {
+         set(handle, func(get(handle)));
+     }
+
+     /**
+      * @brief Remove a property on the object.
+      *
+      * @param[in] key The property key to remove.
+      */
+     template <typename V>
+     void remove(const PropertyKey& key)
+     {
+         auto&& i = properties_.find(key);
+         if (i != properties_.end()) {
+             properties_.erase(i);
+             return;
+         }
+         if (PropertyHandle<V> handle = slot<V>(key); handle.valid())
+             reset(handle);
+     }
+     template<>
+     void remove<double>(const PropertyKey& key)
+     {
+         auto&& i = double_properties_.find(key);
+         if (i != double_properties_.end()) {
+             double_properties_.erase(i);
+             return;
+         }
+         if (PropertyHandle<double> handle = slot<double>(key); handle.valid())
+             reset(handle);
+     }
+     template<>
+     void remove<int>(const PropertyKey& key)
+     {
+         auto&& i = int_properties_.find(key);
+         if (i != int_properties_.end()) {
+             int_properties_.erase(i);
+             return;
+         }
+         if (PropertyHandle<int> handle = slot<int>(key); handle.valid())
+             reset(handle);
+     }
+
+     /**
+      * @brief Returns true if a property has been set.
+      *
+      * @param[in] key The property key to look for.
+      *
+      * @return True if the property exists.
+      */
+     template <typename V>
+     bool has(const PropertyKey& key)
+     {
+         if (properties_.find(key) != properties_.end())
+             return true;
+         PropertyHandle<V> handle = slot<V>(key);
+         return handle.valid() && is_set(handle);
+     }
+     template<>
+     bool has<double>(const PropertyKey& key)
+     {
+         if (double_properties_.find(key) != double_properties_.end())
+             return true;
+         PropertyHandle<double> handle = slot<double>(key);
+         return handle.valid() && is_set(handle);
+     }
+     template<>
+     bool has<int>(const PropertyKey& key)
+     {
+         if (int_properties_.find(key) != int_properties_.end())
+             return true;
+         PropertyHandle<int> handle = slot<int>(key);
+         return handle.valid() && is_set(handle);
+     }
+
+     /**
+      * @brief Set a property on the object.
+      *
+      * @param key The name of the property.
+      * @param value A value to store on the object.
+      */
+     template <typename V>
+     void set(const PropertyKey& key, const V& value)
+     {
+         auto i = properties_.lower_bound(key);
+         if (i != properties_.end() && i->first == key) {
+             i->second = value;
+             return;
+         }
+         if (PropertyHandle<V> handle = slot<V>(key); handle.valid()) {
+             set(handle, value);
+             return;
+         }
+         properties_.emplace_hint(i, key, value);
+     }
+     template<>
+     void set<double>(const PropertyKey& key, const double& value)
+     {
+         auto i = double_properties_.lower_bound(key);
+         if (i != double_properties_.end() && i->first == key) {
+             i->second = value;
+             return;
+         }
+         if (PropertyHandle<double> handle = slot<double>(key); handle.valid()) {
+             set(handle, value);
+             return;
+         }
+         double_properties_.emplace_hint(i, key, value);
+     }
+     template<>
+     void set<int>(const PropertyKey& key, const int& value)
+     {
+         auto i = int_properties_.lower_bound(key);
+         if (i != int_properties_.end() && i->first == key) {
+             i->second = value;
+             return;
+         }
+         if (PropertyHandle<int> handle = slot<int>(key); handle.valid()) {
+             set(handle, value);
+             return;
+         }
+         int_properties_.emplace_hint(i, key, value);
+     }
+
+     /**
+      * @brief Attempts to update a property using a supplied function.
+      *
+      * @param[in] key The name of the property to update.
+      * @param  func The function used to update the property.
+      *
+      * @returns True if the property exists, false otherwise.
+      */
+     template <typename V>
+     bool try_update(const PropertyKey& key, std::function<V (const V&)> func)
+     {
+         auto&& i = properties_.find(key);
+         if (i != properties_.end()) {
+             i->second = func(std::any_cast<V>(i->second));
+             return true;
+         }
+         PropertyHandle<V> handle = slot<V>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         update(handle, func);
+         return true;
+     }
+     template<>
+     bool try_update<double>(const PropertyKey& key, std::function<double (const double&)> func)
+     {
+         auto&& i = double_properties_.find(key);
+         if (i != double_properties_.end()) {
+             i->second = func(i->second);
+             return true;
+         }
+         PropertyHandle<double> handle = slot<double>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         update(handle, func);
+         return true;
+     }
+     template<>
+     bool try_update<int>(const PropertyKey& key, std::function<int (const int&)> func)
+     {
+         auto&& i = int_properties_.find(key);
+         if (i != int_properties_.end()) {
+             i->second = func(i->second);
+             return true;
+         }
+         PropertyHandle<int> handle = slot<int>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         update(handle, func);
+         return true;
+     }
+
+     /**
+      * @brief Get a property on the object.
+      *
+      * @param[in] key The name of the property to retrieve.
+      * @param[out] value The value stored on the the object.
+      *
+      * @return True if property exists.
+      */
+     template <typename V>
+     bool try_get(const PropertyKey& key, V& value) const
+     {
+         auto&& i = properties_.find(key);
+         if (i != properties_.end()) {
+             value = std::any_cast<V>(i->second);
+             return true;
+         }
+         PropertyHandle<V> handle = slot<V>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         value = get(handle);
+         return true;
+     }
+     template<>
+     bool try_get<double>(const PropertyKey& key, double& value) const
+     {
+         auto&& i = double_properties_.find(key);
+         if (i != double_properties_.end()) {
+             value = i->second;
+             return true;
+         }
+         PropertyHandle<double> handle = slot<double>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         value = get(handle);
+         return true;
+     }
+     template<>
+     bool try_get<int>(const PropertyKey& key, int& value) const
+     {
+         auto&& i = int_properties_.find(key);
+         if (i != int_properties_.end()) {
+             value = i->second;
+             return true;
+         }
+         PropertyHandle<int> handle = slot<int>(key);
+         if (!handle.valid() || !is_set(handle))
+             return false;
+         value = get(handle);
+         return true;
+     }
+
+     /**
+      * @brief Get a property on the object.
+      *
+      * @param[in] key The name of the property to retrieve.
+      *
+      * @return The value stored on the the object.
+      */
+     template<typename V>
+     V get(const PropertyKey& key) const
+     {
+         auto&& p = properties_.find(key);
+         if (p == properties_.end()) {
+             if (PropertyHandle<V> handle = slot<V>(key); handle.valid() && is_set(handle))
+                 return get(handle);
+             std::stringstream ss;
+             std::string name = std::visit([](auto&& arg) -> std::string {
+                 using C = std::decay_t<decltype(arg)>;
+                 if constexpr (std::is_same_v<C, std::string>) {
+                     return arg;
+                 }
+                 else if constexpr (std::is_same_v<C, int>) {
+                     return std::to_string(arg);
+                 }
+                 else if constexpr (std::is_same_v<C, void*>) {
+                     std::stringstream ss;
+                     ss << arg;
+                     return ss.str();
+                 }
+                 else {
+                     return "";
+                 }
+             }, key);
+             throw std::runtime_error("Property does not exist: " + name);
+         }
+
+         return std::any_cast<V>(p->second);
+     }
+     template<>
+     double get<double>(const PropertyKey& key) const
+     {
+         auto&& p = double_properties_.find(key);
+         if (p == double_properties_.end()) {
+             if (PropertyHandle<double> handle = slot<double>(key); handle.valid() && is_set(handle))
+                 return get(handle);
+             std::stringstream ss;
+             std::string name = std::visit([](auto&& arg) -> std::string {
+                 using C = std::decay_t<decltype(arg)>;
+                 if constexpr (std::is_same_v<C, std::string>) {
+                     return arg;
+                 }
+                 else if constexpr (std::is_same_v<C, int>) {
+                     return std::to_string(arg);
+                 }
+                 else if constexpr (std::is_same_v<C, void*>) {
+                     std::stringstream ss;
+                     ss << arg;
+                     return ss.str();
+                 }
+                 else {
+                     return "";
+                 }
+             }, key);
+             throw std::runtime_error("Property does not exist: " + name);
+         }
+
+         return p->second;
+     }
+     template<>
+     int get<int>(const PropertyKey& key) const
+     {
+         auto&& p = int_properties_.find(key);
+         if (p == int_properties_.end()) {
+             if (PropertyHandle<int> handle = slot<int>(key); handle.valid() && is_set(handle))
+                 return get(handle);
+             std::stringstream ss;
+             std::string name = std::visit([](auto&& arg) -> std::string {
+                 using C = std::decay_t<decltype(arg)>;
+                 if constexpr (std::is_same_v<C, std::string>) {
+                     return arg;
+                 }
+                 else if constexpr (std::is_same_v<C, int>) {
+                     return std::to_string(arg);
+                 }
+                 else if constexpr (std::is_same_v<C, void*>) {
+                     std::stringstream ss;
+                     ss << arg;
+                     return ss.str();
+                 }
+                 else {
+                     return "";
+                 }
+             }, key);
+             throw std::runtime_error("Property does not exist: " + name);
+         }
+
+         return p->second;
+     }
+
+private:
+    /**
+     * @brief Resolves a key in the schema, only after the key was not found among the
+     * properties stored by key, so undeclared keys pay a single lookup. The schema is not
+     * searched at all when it declares no property of the type.
+     *
+     * @param key The property key.
+     *
+     * @return The handle, invalid if there is no schema or the key is not declared.
+     */
+    template <typename V>
+    PropertyHandle<V> slot(const PropertyKey& key) const
+    {
+        if (!schema_ || schema_->defaults()->slots<V>().empty())
+            return PropertyHandle<V>();
+        return schema_->handle<V>(key);
+    }
+
+    /**
+     * @brief Checks that a handle was resolved in the schema of this container.
+     *
+     * @param handle The handle.
+     *
+     * @throws std::runtime_error If the handle is invalid, the container is not bound to a
+     *         schema or is bound to another schema.
+     */
+    template <typename V>
+    void check(PropertyHandle<V> handle) const
+    {
+        if (!handle.valid() || handle.schema() != schema_)
+            throw std::runtime_error("Property handle does not belong to the schema of the container");
+    }
+
+    /**
+     * @param handle A handle resolved in the schema.
+     *
+     * @return True if the slot has been set on the object.
+     */
+    template <typename V>
+    bool is_set(PropertyHandle<V> handle) const
+    {
+        const std::vector<bool>& flags = values_->set_flags<V>();
+        return handle.index() < flags.size() && flags[handle.index()];
+    }
+
+    /**
+     * @brief Restores the schema default of a slot and marks it as not set.
+     *
+     * @param handle A handle resolved in the schema.
+     */
+    template <typename V>
+    void reset(PropertyHandle<V> handle)
+    {
+        if (!is_set(handle))
+            return;
+        PropertyValues& values = writable_values();
+        values.slots<V>()[handle.index()] = schema_->defaults()->slots<V>()[handle.index()];
+        values.set_flags<V>()[handle.index()] = false;
+    }
+
+    /**
+     * @brief Gets the slot values for writing, copying the shared values first if needed.
+     *
+     * Slots that were declared in the schema after the values were copied are filled with
+     * their defaults.
+     *
+     * @return The values owned by this container.
+     */
+    PropertyValues& writable_values()
+    {
+        const PropertyValues& defaults = *schema_->defaults();
+        if (values_.use_count() > 1)
+            values_ = std::make_shared<PropertyValues>(*values_);
+        for (size_t i = values_->doubles.size(); i < defaults.doubles.size(); ++i)
+            values_->doubles.push_back(defaults.doubles[i]);
+        for (size_t i = values_->ints.size(); i < defaults.ints.size(); ++i)
+            values_->ints.push_back(defaults.ints[i]);
+        for (size_t i = values_->values.size(); i < defaults.values.size(); ++i)
+            values_->values.push_back(defaults.values[i]);
+        values_->doubles_set.resize(values_->doubles.size(), false);
+        values_->ints_set.resize(values_->ints.size(), false);
+        values_->values_set.resize(values_->values.size(), false);
+        return *values_;
+    }
+
+    /** @brief The schema of the slot properties, if any. */
+    const PropertySchema *schema_ = nullptr;
+
+    /** @brief The slot values, shared with the schema defaults until written. */
+    std::shared_ptr<PropertyValues> values_;
+
+    std::map<PropertyKey, std::any> properties_;
+    std::map<PropertyKey, double> double_properties_;
+    std::map<PropertyKey, int> int_properties_;
+};
+
+} // namespace xsim
+
+#endif // PROPERTYCONTAINER_H
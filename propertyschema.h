@@ -0,0 +1,240 @@
+#ifndef PROPERTYSCHEMA_H
+#define PROPERTYSCHEMA_H
+
+#include <xsim_config>
+#include <any>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace xsim {
+
+/** @brief The key of a property. */
+typedef std::variant<std::string, int, void*> PropertyKey;
+
+class PropertySchema;
+
+/**
+ * @brief The flat storage of the properties declared in a PropertySchema.
+ *
+ * Each slot is an index into the vector that matches the type of the
+ * property, so a value is read or written without a key lookup.
+ */
+struct XSIM_EXPORT PropertyValues {
+    std::vector<double> doubles;
+    std::vector<int> ints;
+    std::vector<std::any> values;
+
+    /**
+     * @brief True for the slots that have been set on the object, the
+     *        other slots hold the schema default. Empty in the defaults.
+     */
+    std::vector<bool> doubles_set;
+    std::vector<bool> ints_set;
+    std::vector<bool> values_set;
+
+    /**
+     * @tparam V The property type.
+     *
+     * @returns The vector that holds properties of type V.
+     */
+    template <typename V>
+    auto& slots()
+    {
+        if constexpr (std::is_same_v<V, double>)
+            return doubles;
+        else if constexpr (std::is_same_v<V, int>)
+            return ints;
+        else
+            return values;
+    }
+
+    template <typename V>
+    const auto& slots() const
+    {
+        return const_cast<PropertyValues*>(this)->slots<V>();
+    }
+
+    /**
+     * @tparam V The property type.
+     *
+     * @returns The flags that tell which slots of type V have been set.
+     */
+    template <typename V>
+    std::vector<bool>& set_flags()
+    {
+        if constexpr (std::is_same_v<V, double>)
+            return doubles_set;
+        else if constexpr (std::is_same_v<V, int>)
+            return ints_set;
+        else
+            return values_set;
+    }
+
+    template <typename V>
+    const std::vector<bool>& set_flags() const
+    {
+        return const_cast<PropertyValues*>(this)->set_flags<V>();
+    }
+};
+
+/**
+ * @brief A typed reference to a property slot.
+ *
+ * Obtained once from a PropertySchema and then used to access the property
+ * of every entity that uses the schema.
+ *
+ * @tparam V The property type.
+ */
+template <typename V>
+class PropertyHandle {
+public:
+    PropertyHandle() : schema_(nullptr), index_(std::numeric_limits<uint32_t>::max()) {}
+
+    /**
+     * @returns True if the handle refers to a declared property.
+     */
+    bool valid() const { return schema_ != nullptr; }
+
+    /**
+     * @returns The schema the handle was resolved in.
+     */
+    const PropertySchema* schema() const { return schema_; }
+
+    /**
+     * @returns The slot index within the values of type V.
+     */
+    uint32_t index() const { return index_; }
+
+private:
+    friend class PropertySchema;
+
+    PropertyHandle(const PropertySchema *schema, uint32_t index) : schema_(schema), index_(index) {}
+
+    const PropertySchema *schema_;
+    uint32_t index_;
+};
+
+/**
+ * @brief Maps property keys to fixed slots.
+ *
+ * A schema is declared per Variant, either explicitly or from the properties
+ * that are found when the model is loaded. The default values are shared by
+ * all property containers that use the schema until a value is written.
+ */
+class XSIM_EXPORT PropertySchema {
+public:
+    PropertySchema() : defaults_(std::make_shared<PropertyValues>()) {}
+
+    /** Copying and moving schemas is not supported. */
+    PropertySchema(const PropertySchema&) = delete;
+    PropertySchema& operator=(const PropertySchema&) = delete;
+
+    /**
+     * @brief Declares a property, or updates the default value of an already
+     *        declared property of the same type.
+     *
+     * Properties should be declared before any entity is created, containers
+     * that were bound earlier fall back on the default value.
+     *
+     * @param key           The property key.
+     * @param default_value The value of the property until it is set.
+     *
+     * @returns A handle to the property, invalid if the key is already
+     *          declared with another type.
+     */
+    template <typename V>
+    PropertyHandle<V> declare(const PropertyKey& key, const V& default_value)
+    {
+        if (defaults_.use_count() > 1)
+            defaults_ = std::make_shared<PropertyValues>(*defaults_);
+
+        auto& slots = defaults_->slots<V>();
+        auto i = slots_.find(key);
+        if (i != slots_.end()) {
+            if (i->second.kind != kind<V>())
+                return PropertyHandle<V>();
+            slots[i->second.index] = default_value;
+            return PropertyHandle<V>(this, i->second.index);
+        }
+
+        uint32_t index = static_cast<uint32_t>(slots.size());
+        slots.push_back(default_value);
+        slots_.emplace(key, Slot{ kind<V>(), index });
+        return PropertyHandle<V>(this, index);
+    }
+
+    /**
+     * @brief Resolves a property key.
+     *
+     * @param key The property key.
+     *
+     * @returns A handle to the property, invalid if the key is not declared
+     *          or is declared with another type.
+     */
+    template <typename V>
+    PropertyHandle<V> handle(const PropertyKey& key) const
+    {
+        auto i = slots_.find(key);
+        if (i == slots_.end() || i->second.kind != kind<V>())
+            return PropertyHandle<V>();
+        return PropertyHandle<V>(this, i->second.index);
+    }
+
+    /**
+     * @returns The default values, shared with the containers that have not
+     *          written any value.
+     */
+    const std::shared_ptr<PropertyValues>& defaults() const { return defaults_; }
+
+    /**
+     * @returns The number of declared properties.
+     */
+    size_t size() const { return slots_.size(); }
+
+    /**
+     * @returns All declared keys.
+     */
+    std::vector<PropertyKey> keys() const
+    {
+        std::vector<PropertyKey> keys;
+        keys.reserve(slots_.size());
+        for (auto& [key, slot] : slots_)
+            keys.push_back(key);
+        return keys;
+    }
+
+private:
+    enum Kind : uint8_t { DOUBLE, INT, ANY };
+
+    struct Slot {
+        Kind kind;
+        uint32_t index;
+    };
+
+    template <typename V>
+    static constexpr Kind kind()
+    {
+        if constexpr (std::is_same_v<V, double>)
+            return DOUBLE;
+        else if constexpr (std::is_same_v<V, int>)
+            return INT;
+        else
+            return ANY;
+    }
+
+    /** @brief The slot of each declared key. */
+    std::map<PropertyKey, Slot> slots_;
+
+    /** @brief The default values of all slots. */
+    std::shared_ptr<PropertyValues> defaults_;
+};
+
+} // namespace xsim
+
+#endif // PROPERTYSCHEMA_H
@@ -1,122 +1,186 @@
-﻿#ifndef RESOURCEMANAGER_H
-#define RESOURCEMANAGER_H
-
-#include <xsim_config>
-#include <string>
-#include <vector>
-#include <map>
-
-#include "node.h"
-
-namespace xsim {
-
-class ExitPort;
-class LogicResource;
-class Entity;
-class NodeResource;
-class NodeSkill;
-class NumberGenerator;
-
-struct ResourceSkill {
-    std::string name;
-    double execution_factor;
-};
-
-struct Resource {
-    std::string name;
-    bool active;
-    int amount;
-    std::vector<ResourceSkill> skills;
-};
-
-/**
- * @brief Manages a set of resources.
- */
-class XSIM_EXPORT ResourceManager : public Node {
- public:
-     class BlockListItem {
-     public:
-         BlockListItem(NodeResource *r, Entity *e, Node *n, Failure *f, ResourceType type) :
-             resource(r),
-             entity(e),
-             node(n),
-             failure(f),
-             type_(type)
-         { }
-         NodeResource *resource;
-         Entity *entity;
-         Node *node;
-         Failure *failure;
-         ResourceType type_;
-     };
-
-     /**
-      * @brief Constructor.
-      */
-     ResourceManager();
-
-     /**
-      * @brief Destructor.
-      */
-     virtual ~ResourceManager();
-
-     void init() override;
-     void finalize() override;
-     void reset_stats() override;
-     void add_failure(Failure* failure) override;
-
-     /* Documented in node.h */
-     void unplanned_begin() override;
-     void unplanned_end() override;
-     void paused_begin() override;
-     void paused_end() override;
-     size_t max_occupation() const override;
-     size_t content_size() const override;
-
-     /** @brief Prepare for simulation by creating the resource objects. */
-     virtual void pre_simulation_init();
-
-     void add_resource(Resource *resource);
-     const std::vector<Resource*>& resources() const;
-
-     void add_logic_resource(LogicResource *resource);
-     //Resource* request_processing_resource(Skill *skill);
-     bool allocate_resources(NodeResource *node_resource, bool interrupt, Entity *entity, Failure *failure, ResourceType type);
-     //bool interrupt_processing_resources(NodeResource *node_resource, Entity *entity, Failure *failure, ResourceType type);
-     void add_to_block_list(NodeResource *resource, Entity *entity, Node *node, Failure *failure, ResourceType type);
-     void remove_from_block_list(NodeResource *resource, Entity *entity);
-     void set_response_time(NumberGenerator *response_time_generator);
-     NumberGenerator* response_time() const;
-     void trigger_blocklist();
-
-	 std::list<LogicResource*> all_resources() const;
-
-     void define_outputs() override;
-     void set_outputs() override;
-
- private:
-     typedef std::list<LogicResource*>::iterator resource_iter;
-
-     /**
-      * @brief Gets the average of a specific output from all operations.
-      *
-      * @param name The name of the output to get the average of.
-      *
-      * @returns The average value.
-      */
-     double average_output(const std::string &name) const;
-
-     std::vector<Node*> nodes_;
-     std::vector<Resource*> resources_;
-     std::list<LogicResource*> logic_resources_;
-     std::list<LogicResource*> all_logic_resources_;
-     std::list<LogicResource*> allocated_;
-     std::list<BlockListItem> block_list_;
-     NumberGenerator *response_time_;
-     //std::list<std::pair<EnterPort*, Skill*> > block_list_;
-     //std::map<Skill*, std::list<Node*> > block_list_;
-};
-
-} // namespace xsim
-
-#endif // OPERATION_H
+﻿#ifndef RESOURCEMANAGER_H
+#define RESOURCEMANAGER_H
+
+#include <xsim_config>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "node.h"
+#include "skillmatcher.h"
+
+namespace xsim {
+
+class ExitPort;
+class LogicResource;
+class Entity;
+class NodeResource;
+class NodeSkill;
+class NumberGenerator;
+
+struct ResourceSkill {
+    std::string name;
+    double execution_factor;
+};
+
+struct Resource {
+    std::string name;
+    bool active;
+    int amount;
+    std::vector<ResourceSkill> skills;
+};
+
+/**
+ * @brief Manages a set of resources.
+ */
+class XSIM_EXPORT ResourceManager : public Node {
+ public:
+     class BlockListItem {
+     public:
+         BlockListItem(NodeResource *r, Entity *e, Node *n, Failure *f, ResourceType type) :
+             resource(r),
+             entity(e),
+             node(n),
+             failure(f),
+             type_(type)
+         { }
+         NodeResource *resource;
+         Entity *entity;
+         Node *node;
+         Failure *failure;
+         ResourceType type_;
+         /** @brief The skills the request requires. */
+         SkillSet required;
+         /**
+          * @brief The skills the request still misses, the group of
+          * skill_block_list_ it is in. Kept current by rekey_blocked().
+          */
+         SkillSet outstanding;
+     };
+
+     /**
+      * @brief Constructor.
+      */
+     ResourceManager();
+
+     /**
+      * @brief Destructor.
+      */
+     virtual ~ResourceManager();
+
+     void init() override;
+     void finalize() override;
+     void reset_stats() override;
+     void add_failure(Failure* failure) override;
+
+     /* Documented in node.h */
+     void unplanned_begin() override;
+     void unplanned_end() override;
+     void paused_begin() override;
+     void paused_end() override;
+     size_t max_occupation() const override;
+     size_t content_size() const override;
+
+     /**
+      * @brief Prepare for simulation by creating the resource objects.
+      *
+      * Also builds the skill matcher from the skills of the logic resources.
+      */
+     virtual void pre_simulation_init();
+
+     void add_resource(Resource *resource);
+     const std::vector<Resource*>& resources() const;
+
+     void add_logic_resource(LogicResource *resource);
+     //Resource* request_processing_resource(Skill *skill);
+     bool allocate_resources(NodeResource *node_resource, bool interrupt, Entity *entity, Failure *failure, ResourceType type);
+     //bool interrupt_processing_resources(NodeResource *node_resource, Entity *entity, Failure *failure, ResourceType type);
+     void add_to_block_list(NodeResource *resource, Entity *entity, Node *node, Failure *failure, ResourceType type);
+     void remove_from_block_list(NodeResource *resource, Entity *entity);
+     void set_response_time(NumberGenerator *response_time_generator);
+     NumberGenerator* response_time() const;
+     void trigger_blocklist();
+
+     /**
+      * @brief Retry the blocked requests after a resource was released.
+      *
+      * Only requests that still miss a skill of the released resource, and
+      * whose missing skills are all held by idle resources, are retried,
+      * together with the requests that miss no skill.
+      *
+      * @param released The released resource.
+      */
+     void trigger_blocklist(LogicResource *released);
+
+     /**
+      * @returns The skill matcher of the logic resources.
+      */
+     const SkillMatcher& skill_matcher() const { return skill_matcher_; }
+
+	 std::list<LogicResource*> all_resources() const;
+
+     void define_outputs() override;
+     void set_outputs() override;
+
+ private:
+     typedef std::list<LogicResource*>::iterator resource_iter;
+
+     /**
+      * @brief Gets the average of a specific output from all operations.
+      *
+      * @param name The name of the output to get the average of.
+      *
+      * @returns The average value.
+      */
+     double average_output(const std::string &name) const;
+
+     std::vector<Node*> nodes_;
+     std::vector<Resource*> resources_;
+     std::list<LogicResource*> logic_resources_;
+     std::list<LogicResource*> all_logic_resources_;
+     std::list<LogicResource*> allocated_;
+     std::list<BlockListItem> block_list_;
+
+     /**
+      * @brief Finds idle logic resources with a bitset AND per skill in
+      * presorted pools, replaces sorting the candidates on each allocation.
+      */
+     SkillMatcher skill_matcher_;
+
+     /**
+      * @brief The items of block_list_ grouped by the skills they still miss,
+      * rekeyed when a skills-first request acquires some of its resources.
+      */
+     SkillBlockList<BlockListItem> skill_block_list_;
+
+     /**
+      * @brief Moves a blocked request to the group of the skills it misses
+      * now and records them in the item.
+      *
+      * @param item        The blocked request.
+      * @param outstanding The skills it misses now.
+      */
+     void rekey_blocked(BlockListItem &item, const SkillSet &outstanding)
+     {
+         skill_block_list_.rekey(item.outstanding, outstanding, &item);
+         item.outstanding = outstanding;
+     }
+
+     /**
+      * @brief Removes a blocked request from skill_block_list_, by the
+      * skills it misses now.
+      *
+      * @param item The blocked request.
+      */
+     void unindex_blocked(BlockListItem &item)
+     {
+         skill_block_list_.remove(item.outstanding, &item);
+     }
+     NumberGenerator *response_time_;
+     //std::list<std::pair<EnterPort*, Skill*> > block_list_;
+     //std::map<Skill*, std::list<Node*> > block_list_;
+};
+
+} // namespace xsim
+
+#endif // OPERATION_H
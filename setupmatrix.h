@@ -0,0 +1,151 @@
+#ifndef SETUPMATRIX_H
+#define SETUPMATRIX_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace xsim {
+
+class NumberGenerator;
+
+/**
+ * @brief A dense from × to matrix of setup times.
+ *
+ * The matrix covers the variants of one setup table, which are given local
+ * indices in the order of the table. A second vector maps the global
+ * Variant::index() to the local index, so entities can be looked up without
+ * a search.
+ *
+ * Each cell holds the mean setup time, which is the setup time itself for
+ * deterministic number generators, and the number generator to draw from
+ * for stochastic ones. Rows are contiguous per from variant, so scoring
+ * all blocked entities against the current variant reads a single row.
+ */
+class SetupMatrix {
+public:
+    /** @brief Local index of a variant that is not in the matrix. */
+    static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+    SetupMatrix() : size_(0) {}
+
+    /**
+     * @brief Resizes the matrix and clears all cells.
+     *
+     * @param size         The number of variants in the matrix.
+     * @param global_count The number of variants in the simulation.
+     */
+    void reset(size_t size, size_t global_count)
+    {
+        size_ = size;
+        means_.assign(size * size, 0.0);
+        generators_.assign(size * size, nullptr);
+        local_.assign(global_count, NO_INDEX);
+    }
+
+    /**
+     * @brief Maps a global variant index to a local index.
+     *
+     * @param global The Variant::index() of the variant.
+     * @param local  The index in the matrix.
+     */
+    void set_local_index(uint32_t global, uint32_t local)
+    {
+        if (global >= local_.size())
+            local_.resize(global + 1, NO_INDEX);
+        local_[global] = local;
+    }
+
+    /**
+     * @param global The Variant::index() of a variant.
+     *
+     * @returns The index in the matrix, or NO_INDEX.
+     */
+    uint32_t local_index(uint32_t global) const
+    {
+        return global < local_.size() ? local_[global] : NO_INDEX;
+    }
+
+    /**
+     * @brief Sets a cell.
+     *
+     * @param to        The local index of the variant to switch to.
+     * @param from      The local index of the variant to switch from.
+     * @param mean      The mean setup time.
+     * @param generator The number generator if it is stochastic, otherwise nullptr.
+     */
+    void set(uint32_t to, uint32_t from, double mean, NumberGenerator *generator)
+    {
+        means_[from * size_ + to] = mean;
+        generators_[from * size_ + to] = generator;
+    }
+
+    /**
+     * @returns The mean setup time from one local index to another.
+     */
+    double mean(uint32_t to, uint32_t from) const
+    {
+        return means_[from * size_ + to];
+    }
+
+    /**
+     * @returns The stochastic number generator from one local index to
+     *          another, or nullptr if the setup time is deterministic.
+     */
+    NumberGenerator* generator(uint32_t to, uint32_t from) const
+    {
+        return generators_[from * size_ + to];
+    }
+
+    /**
+     * @returns The mean setup times of all variants when switching from a
+     *          local index, indexed by the local index switched to.
+     */
+    const double* row(uint32_t from) const
+    {
+        return means_.data() + from * size_;
+    }
+
+    /**
+     * @returns The number of variants in the matrix.
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Gathers the setup times of many variants from one row.
+     *
+     * @param from   The local index switched from.
+     * @param to     The local indices switched to, all valid.
+     * @param count  The number of indices.
+     * @param times  Receives the setup times.
+     */
+    void gather(uint32_t from, const uint32_t *to, size_t count, double *times) const
+    {
+        const double *values = row(from);
+        size_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4) {
+            __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + i));
+            _mm256_storeu_pd(times + i, _mm256_i32gather_pd(values, index, 8));
+        }
+#endif
+        for (; i < count; ++i)
+            times[i] = values[to[i]];
+    }
+
+private:
+    size_t size_;
+    std::vector<double> means_;
+    std::vector<NumberGenerator*> generators_;
+    std::vector<uint32_t> local_;
+};
+
+} // namespace xsim
+
+#endif // SETUPMATRIX_H
@@ -1,204 +1,285 @@
-#ifndef SHIFTCALENDAR_H
-#define SHIFTCALENDAR_H
-
-#include <xsim_config>
-#include <list>
-#include <string>
-#include <vector>
-
-#include "object.h"
-
-namespace xsim {
-
-class BreakItem {
-public:
-    std::string start;
-    std::string end;
-};
-
-class ShiftCalendarItem {
-public:
-    std::string name;
-    double start;
-    double end;
-    bool monday;
-    bool tuesday;
-    bool wednesday;
-    bool thursday;
-    bool friday;
-    bool saturday;
-    bool sunday;
-
-    /**
-     * @brief Adds a break
-     *
-     * @param  start The start of the break.
-     * @param  end   The end of the break.
-     */
-    void add_break(const std::string& start, const std::string& end)
-    {
-        breaks.push_back({ start, end });
-    }
-
-    std::vector<BreakItem> breaks;
-};
-
-class Event;
-class Node;
-class Shift;
-class Simulation;
-
-/**
- * @brief Controls the time a node is available.
- */
-class XSIM_EXPORT ShiftCalendar : public Object {
- public:
-     /**
-      * @brief Constructor.
-      */
-     ShiftCalendar();
-
-     /** @brief Destructor */
-     ~ShiftCalendar();
-
-     /** @brief Prepare for simulation by creating shift objects */
-     virtual void pre_simulation_init();
-
-     void init() override;
-
-     /**
-      * @brief Add a node that should follow this shift.
-      *
-      * @param node The node to add.
-      */
-     void add_node(Node *node);
-
-     /**
-      * @brief Removes a node from the shift calendar.
-      *
-      * @param  node The node to remove.
-      */
-     void remove_node(Node *node);
-
-     /** @brief Removes all nodes from the shift calendar. */
-     void clear_nodes();
-
-     /**
-      * @returns The nodes that follow this shift calendar.
-      */
-     const std::vector<Node*>& nodes() const;
-
-     /**
-      * @brief Add a shift.
-      *
-      * @param name The name of the shift.
-      * @param start The simulation start time of the shift.
-      * @param end The simulation end time of the shift.
-      * @param monday True if the shift should be active on monday.
-      * @param tuesday True if the shift should be active on tuesday.
-      * @param wednesday True if the shift should be active on wednesday.
-      * @param thursday True if the shift should be active on thursday.
-      * @param friday True if the shift should be active on friday.
-      * @param saturday True if the shift should be active on saturday.
-      * @param sunday True if the shift should be active on sunday.
-      *
-      * @return The new shift.
-      */
-     ShiftCalendarItem* add_shift(std::string name, simtime start, simtime end, bool monday,
-             bool tuesday, bool wednesday, bool thursday, bool friday,
-             bool saturday, bool sunday);
-
-     /**
-      * @returns All shift items.
-      */
-     const std::vector<ShiftCalendarItem*>& shifts() const;
-
-     /**
-      * @brief Schedule a new shift.
-      */
-     void schedule_shift();    
-
-     /**
-      * @brief Perform actions at the start of the shift.
-      */
-     void shift_begin();
-
-     /**
-      * @brief Perform actions at the end of the shift.
-      */
-     void shift_end();
-
-     /**
-      * @brief Perform actions at the start of the break.
-      */
-     void break_begin();
-
-     /**
-      * @brief Perform actions at the end of the break.
-      */
-     void break_end();
-
- private:
-     class ShiftItem {
-      public:
-          Shift *shift;
-          simtime start;
-          simtime length;
-     };
-     /**
-      * @brief Insert a new shifts.
-      *
-      * @param start The start simulation time the shift should start.
-      * @param end The end simulation time of the shift.
-      */
-     void insert_shift(Shift *shift, simtime start, simtime length);
-     
-     /**
-      * @brief Calculates how many seconds there to the next shift start.
-      * Normalized to one week.
-      *
-      * @param next_start The start of the next shift, it is normalized to one
-      * week.
-      *
-      * @return How many seconds to the next shift start.
-      */
-     simtime seconds_to_next_start(simtime next_start);
-
-     /**
-      * @brief All nodes that follow this shift.
-      */
-     std::vector<Node*> nodes_;
-
-     /**
-      * @brief All shift items in this shift calendar.
-      */
-     std::vector<ShiftItem> shift_items_;
-
-     /**
-      * @brief All shifts in this shift calendar.
-      */
-     std::vector<ShiftCalendarItem*> shifts_;
-
-     /**
-      * @brief An iterator pointing to the currently active shift item.
-      */
-     std::vector<ShiftItem>::iterator current_shift_;
-
-     Event *shift_end_event_;
-
-     /**
-      * @brief The time in seconds from the start date to the preceding
-      * Monday midnight.
-      */
-     double offset_from_monday_midnight_;
-
-     /** @brief True if the current shift is unplanned */
-     bool unplanned_;
-
-     /** @brief True if the current shift is paused */
-     bool paused_;
-};
-
-} // namespace xsim
-
-#endif // SHIFTCALENDAR_H
+#ifndef SHIFTCALENDAR_H
+#define SHIFTCALENDAR_H
+
+#include <xsim_config>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "calendarstate.h"
+#include "object.h"
+
+namespace xsim {
+
+class BreakItem {
+public:
+    std::string start;
+    std::string end;
+};
+
+class ShiftCalendarItem {
+public:
+    std::string name;
+    double start;
+    double end;
+    bool monday;
+    bool tuesday;
+    bool wednesday;
+    bool thursday;
+    bool friday;
+    bool saturday;
+    bool sunday;
+
+    /**
+     * @brief Adds a break
+     *
+     * @param  start The start of the break.
+     * @param  end   The end of the break.
+     */
+    void add_break(const std::string& start, const std::string& end)
+    {
+        breaks.push_back({ start, end });
+    }
+
+    std::vector<BreakItem> breaks;
+};
+
+class Event;
+class Node;
+class Shift;
+class Simulation;
+
+/**
+ * @brief Controls the time a node is available.
+ */
+class XSIM_EXPORT ShiftCalendar : public Object {
+ public:
+     /**
+      * @brief Constructor.
+      */
+     ShiftCalendar();
+
+     /** @brief Destructor */
+     ~ShiftCalendar();
+
+     /** @brief Prepare for simulation by creating shift objects */
+     virtual void pre_simulation_init();
+
+     void init() override;
+
+     /**
+      * @brief Add a node that should follow this shift.
+      *
+      * @param node The node to add.
+      */
+     void add_node(Node *node);
+
+     /**
+      * @brief Removes a node from the shift calendar.
+      *
+      * @param  node The node to remove.
+      */
+     void remove_node(Node *node);
+
+     /** @brief Removes all nodes from the shift calendar. */
+     void clear_nodes();
+
+     /**
+      * @returns The nodes that follow this shift calendar.
+      */
+     const std::vector<Node*>& nodes() const;
+
+     /**
+      * @brief Add a shift.
+      *
+      * @param name The name of the shift.
+      * @param start The simulation start time of the shift.
+      * @param end The simulation end time of the shift.
+      * @param monday True if the shift should be active on monday.
+      * @param tuesday True if the shift should be active on tuesday.
+      * @param wednesday True if the shift should be active on wednesday.
+      * @param thursday True if the shift should be active on thursday.
+      * @param friday True if the shift should be active on friday.
+      * @param saturday True if the shift should be active on saturday.
+      * @param sunday True if the shift should be active on sunday.
+      *
+      * @return The new shift.
+      */
+     ShiftCalendarItem* add_shift(std::string name, simtime start, simtime end, bool monday,
+             bool tuesday, bool wednesday, bool thursday, bool friday,
+             bool saturday, bool sunday);
+
+     /**
+      * @returns All shift items.
+      */
+     const std::vector<ShiftCalendarItem*>& shifts() const;
+
+     /**
+      * @brief Schedule a new shift.
+      */
+     void schedule_shift();    
+
+     /**
+      * @brief Perform actions at the start of the shift.
+      */
+     void shift_begin();
+
+     /**
+      * @brief Perform actions at the end of the shift.
+      */
+     void shift_end();
+
+     /**
+      * @brief Perform actions at the start of the break.
+      */
+     void break_begin();
+
+     /**
+      * @brief Perform actions at the end of the break.
+      */
+     void break_end();
+
+     /**
+      * @brief Let the nodes catch up with shift and break boundaries lazily.
+      *
+      * In lazy mode a boundary only updates the shared calendar state, see
+      * CalendarState, and notifies the nodes that are marked active. A boundary
+      * that ends an unplanned or paused period also catches up the nodes that
+      * are marked waiting and wakes their block lists, sources are always
+      * waiting so they restart creating entities. The other nodes replay the
+      * transitions when they next act, see Node::sync_calendar. Off by default.
+      *
+      * @param value True for lazy mode.
+      */
+     void set_lazy(bool value);
+
+     /**
+      * @return True if the nodes catch up lazily.
+      */
+     bool lazy() const { return lazy_; }
+
+     /**
+      * @return The shared state the nodes read.
+      */
+     const CalendarState& state() const { return state_; }
+
+     /**
+      * @brief Mark a node that has work in progress, such as a scheduled
+      * process end, which must be paused at the boundary itself. Only active
+      * nodes are notified at a boundary in lazy mode.
+      *
+      * @param node   The node.
+      * @param active True if the node has work in progress.
+      */
+     void set_node_active(Node *node, bool active);
+
+     /**
+      * @return The number of active nodes.
+      */
+     size_t active_node_count() const { return active_nodes_.size(); }
+
+     /**
+      * @brief Mark a node that must be woken when a suspension ends, a node
+      * with entities on its block list that are waiting for it to resume.
+      * Sources are marked when they are added.
+      *
+      * @param node    The node.
+      * @param waiting True if the node waits for the calendar.
+      */
+     void set_node_waiting(Node *node, bool waiting);
+
+     /**
+      * @return The number of waiting nodes.
+      */
+     size_t waiting_node_count() const { return waiting_nodes_.size(); }
+
+ private:
+     /**
+      * @brief Change the shared state and notify the nodes, all of them unless
+      * the calendar is lazy.
+      *
+      * @param mode The new mode.
+      */
+     void change_mode(CalendarState::Mode mode);
+
+     class ShiftItem {
+      public:
+          Shift *shift;
+          simtime start;
+          simtime length;
+     };
+     /**
+      * @brief Insert a new shifts.
+      *
+      * @param start The start simulation time the shift should start.
+      * @param end The end simulation time of the shift.
+      */
+     void insert_shift(Shift *shift, simtime start, simtime length);
+     
+     /**
+      * @brief Calculates how many seconds there to the next shift start.
+      * Normalized to one week.
+      *
+      * @param next_start The start of the next shift, it is normalized to one
+      * week.
+      *
+      * @return How many seconds to the next shift start.
+      */
+     simtime seconds_to_next_start(simtime next_start);
+
+     /**
+      * @brief All nodes that follow this shift.
+      */
+     std::vector<Node*> nodes_;
+
+     /**
+      * @brief All shift items in this shift calendar.
+      */
+     std::vector<ShiftItem> shift_items_;
+
+     /**
+      * @brief All shifts in this shift calendar.
+      */
+     std::vector<ShiftCalendarItem*> shifts_;
+
+     /**
+      * @brief An iterator pointing to the currently active shift item.
+      */
+     std::vector<ShiftItem>::iterator current_shift_;
+
+     Event *shift_end_event_;
+
+     /**
+      * @brief The time in seconds from the start date to the preceding
+      * Monday midnight.
+      */
+     double offset_from_monday_midnight_;
+
+     /** @brief True if the current shift is unplanned */
+     bool unplanned_;
+
+     /** @brief True if the current shift is paused */
+     bool paused_;
+
+     /** @brief True if the nodes catch up lazily, see set_lazy(). */
+     bool lazy_;
+
+     /** @brief The shared state the nodes read. */
+     CalendarState state_;
+
+     /**
+      * @brief The nodes with work in progress, each knows its position from
+      * CalendarView::active_slot so removal is a swap with the last.
+      */
+     std::vector<Node*> active_nodes_;
+
+     /**
+      * @brief The nodes to wake when a suspension ends, indexed by
+      * CalendarView::waiting_slot.
+      */
+     std::vector<Node*> waiting_nodes_;
+};
+
+} // namespace xsim
+
+#endif // SHIFTCALENDAR_H
@@ -1,1072 +1,1440 @@
-﻿#ifndef SIMULATION_H
-#define SIMULATION_H
-
-#include <xsim_config>
-#include <chrono>
-#include <list>
-#include <map>
-#include <string>
-#include <vector>
-#include <functional>
-#include <typeinfo>
-#include <sstream>
-#include <random>
-
-#include "date/date.h"
-#include "date/iso_week.h"
-
-#include "common.h"
-#include "component.h"
-#include "eventinfo.h"
-#include "object.h"
-#include "prioritysignal.h"
-#include "poolallocator.h"
-
-#pragma warning(disable : 4996)
-
-namespace xsim {
-
-struct Variable {
-    std::string name;
-    std::string id;
-    std::string data_type;
-    double value_;
-
-    double* value_ptr()
-    {
-        return &value_;
-    }
-
-    int as_int() const
-    {
-        return static_cast<int>(std::round(value_));
-    }
-
-    double as_double() const
-    {
-        return value_;
-    }
-
-    std::string to_string() const
-    {
-        std::stringstream ss;
-        ss << value_;
-        return ss.str();
-    }
-};
-
-class ActivePeriod;
-class Assembly;
-class Batch;
-class Buffer;
-class Breakpoint;
-class CriticalWip;
-class Conveyor;
-class Demand;
-class ExitPort;
-class Event;
-class Disassembly;
-class EventTimeCallback;
-class Facade;
-class Kanban;
-class FailureZone;
-class LogBuffer;
-class MaxWip;
-class Entity;
-class Node;
-class Order;
-class Operation;
-class ParallelOperation;
-class Takt;
-class NumberGenerator;
-class ShiftCalendar;
-class Sink;
-class XSimLLVM;
-class Source;
-class Store;
-class Variant;
-class Skill;
-class ResourceManager;
-
-typedef std::mt19937 RandomGenerator;
-
-/**
- * @brief The simulation manager.
- *
- * Creates and owns all simulation objects and performs the simulation of the
- * events.
- */
-class XSIM_EXPORT Simulation {
- typedef std::function<void (void)> TimeCallback;
-
- public:
-     typedef std::pair<Node*, Entity*> EntityLocation;
-
-     PrioritySignal<void()> simulation_initialized;
-     PrioritySignal<void()> simulation_finalized;
-     PrioritySignal<void()> initialized;
-     PrioritySignal<void()> finalized;
-     PrioritySignal<void()> statistics_reset;
-     Signal<void (const std::string &)> log_changed;
-
-     /**
-      * @brief Deleted copy constructor
-      */
-     Simulation(Simulation const&) = delete;
-
-     /**
-      * @brief Deleted assignment operator
-      */
-     void operator=(Simulation const&) = delete;
-
-     /** @brief Destructor */
-     ~Simulation();
-
-     /** @brief Creates the Simulation instance */
-     static void create_instance(const std::string& source_dir, const std::string& lib_dir, const std::string& build_dir);
-
-     /** @brief Destroys the Simulation instance */
-     static void destroy_instance();
-
-     /** @returns The simulation instance. */
-     static Simulation* instance();
-
-     /** @brief Clears the simulation to its blank/initial state */
-     void clear();
-
-     /**
-      * @brief Sets the seed to the random number generator
-      *
-      * @param  seed The seed.
-      */
-     void set_seed(int seed);
-
-     /**
-      * @brief Attaches the given @p data to the simulation input.
-      *
-      * This function should only be used to transfer user data into the simulation instance. It
-      * will not update the input user data stored in the database. Instead use @ref
-      * set_user_data_output to store user data for later use.
-      *
-      * @param data The data to save.
-      */
-     void set_user_data_input(const std::string& data);
-
-     /**
-      * @return The user data set with @ref set_user_data_input.
-      */
-     std::string user_data_input() const;
-
-     /**
-      * @brief Attaches the given @p data to the simulation output.
-      *
-      * Stores any user data in the database for later use.
-      *
-      * @param data The data to save.
-      */
-     void set_user_data_output(const std::string& data);
-
-     /**
-      * @param replication The replication index, zero based, to get user data for.
-      *
-      * @return The user data set with @ref set_user_data_output.
-      */
-     std::string user_data_output(int replication) const;
-
-     /** @brief Initialize the simulation. */
-     void simulation_init();
-
-     /** @brief Finalize the simulation. */
-     void simulation_finalize();
-
-     /**
-      * @brief Initialize the simulation objects at the start of a simulation replication.
-      *        
-      *        This function must be called before 'simulate' or the first call to 'simulate_step'.
-      *        It's should not be called before 'run'.
-      */
-     void init();
-
-     /** @brief Finalize the simulation objects at the end of a simulation replication. */
-     void finalize();
-
-     /**
-      * @brief Sets the start time point of the simulation.
-      *
-      * @param  start_date The new start time point of the simulation.
-      */
-     void set_start_time_point(std::chrono::system_clock::time_point start_date);
-
-     /**
-      * @returns The current simulation time as a time point.
-      */
-     std::chrono::system_clock::time_point time_point_now() const;
-
-     /**
-      * @returns The year, month and day of the current simulation time.
-      */
-     date::year_month_day year_month_day() const;
-
-     /**
-      * @returns The year and month of the current simulation time.
-      */
-     date::year_month year_month() const;
-
-     /**
-      * @returns The number of days since the simulation start.
-      */
-     date::sys_days days() const;
-
-     /**
-      * @returns The year of the current simulation time.
-      */
-     date::year year() const;
-
-     /**
-      * @returns The month of the current simulation time.
-      */
-     date::month month() const;
-
-     /**
-      * @returns The day of the current simulation time.
-      */
-     date::day day() const;
-
-     /**
-      * @returns The week number of the current simulation time.
-      */
-     iso_week::weeknum week() const;
-
-     /**
-      * @returns The day of week of the current simulation time.
-      */
-     date::weekday day_of_week() const;
-
-     /**
-      * @returns The time of day, in seconds, of the current simulation time.
-      */
-     std::chrono::duration<float> time_of_day() const;
-
-     /**
-      * @brief Get the current simulation time.
-      *
-      * @return The current simulation time.
-      */
-     simtime now() const;
-
-     /**
-      * @brief Get the elapsed time with the warm-up period removed.
-      *
-      * @returns The elapsed time.
-      */
-     simtime elapsed_time() const;
-
-     /**
-      * @brief Schedules an event for execution.
-      *
-      * @param evt The event that should be executed.
-      * @param time The time when the event should be executed, relative to the
-      * current simulation time.
-      */
-     void schedule(Event *evt, simtime time);
-
-     /**
-      * @brief Schedule an event directly before another event.
-      *
-      * @param evt The event that should be exectuted.
-      * @param insert The event before which the new event should be inserted.
-      * @param time The time when the event should be executed, relative to the
-      * current simulation time.
-      */
-     void schedule_before(Event *evt, Event *insert, simtime time);
-
-     /**
-      * @brief Schedules an event for immediate execution.
-      *
-      * @param evt The event that should be executed.
-      */
-     void schedule_now(Event *evt);
-
-     /**
-      * @brief Remove event from event list.
-      *
-      * @param evt The event to remove.
-      */
-     void remove_event(Event *evt);
-
-     /**
-      * @returns  The event that is currently being processed.
-      */
-     const Event* current_event() const;
-
-     /**
-      * @brief Executes one simulation event.
-      *
-      * @return The state of simulation.
-      */
-     int simulate_step();
-
-     /**
-      * @brief Reset statistics collected during the warmup period.
-      */
-     void reset_stats();
-
-     /**
-      * @brief Get the event list.
-      *
-      * @return The current event list.
-      */
-     std::vector<EventInfo> event_list();
-
-     /**
-      * @brief Get the next event to be processed.
-      *
-      * @return The current event.
-      */
-     EventInfo next_event();
-
-     /**
-      * @brief Loads a model from an xml string.
-      *
-      * @param xml The xml string with the model to load.
-      */
-     void load_from_string(std::string xml_str);
-
-     /**
-      * @brief Loads a model from an xml file.
-      *
-      * @param filename The xml file containing the model to load.
-      */
-     void load_from_file(std::string filename);
-
-     void init_simulation(std::string filename);
-
-     /**
-      * @brief Saves the model to a xml file.
-      *
-      * @param  filename The xml file where the model will be saved.
-      */
-     void save_model(const std::string& filename);
-
-     /**
-      * @brief Saves the model to a xml formatted string
-      *
-      * @returns A xml formatted string.
-      */
-     std::string save_model();
-
-     /**
-      * @brief Set warmup period.
-      *
-      * @param time The warmup period in seconds.
-      */
-     void set_warmup(simtime time);
-
-     /**
-      * @brief Set simulation horizon.
-      *
-      * @param time The simulation horizon in seconds.
-      */
-     void set_horizon(simtime time);
-
-     /**
-      * @brief Set the number of simulation replications.
-      *
-      * @param replications The number of replications.
-      */
-     void set_replications(unsigned int replications);
-
-     /**
-      * @brief Starts the simulation and writes the results to a file.
-      *
-      * @param filename The file that the output (xml) of the simulation is
-      * written to.
-      */
-     void run(std::string filename);
-
-     /**
-      * @brief Starts the simulation and returns the results as a string.
-      *
-      * @return An xml string containing the results of the simulation.
-      */
-     std::string run();
-
-     /**
-      * @brief Adds a template
-      *
-      * @param component The template component to add.
-      */
-     void add_template(Component* component);
-
-     /**
-      * @brief Adds a variable.
-      *
-      * @param  name      The name of the variable.
-      * @param  id        The identifier.
-      * @param  data_type Type of the data.
-      * @param  value     The value.
-      */
-     void add_variable(
-            const std::string& name,
-            const std::string& id,
-            const std::string& data_type,
-            const std::string& value);
-
-     /**
-      * @returns All variables.
-      */
-     const std::vector<Variable*>& variables() const;
-
-     /**
-      * @brief Gets a variable.
-      *
-      * @param  id The identifier of the variable.
-      *
-      * @returns The variable if found, otherwise nullptr.
-      */
-     Variable* get_variable(const std::string& id) const;
-
-     /**
-      * @returns All template components.
-      */
-     const std::vector<Component*>& templates() const;
-
-     /**
-      * @brief Adds a skill to the model.
-      *
-      * @param name The name of the skill.
-      */
-     void add_skill(std::string name);
-
-     /**
-      * @returns All skills.
-      */
-     const std::vector<std::string>& skills() const;
-
-     /**
-      * @brief Add a callback that gets called at a specified simulation time.
-      *
-      * @param time The simulation time when the callback should occur.
-      * @param callback The function to call.
-      * @param priority The priority of the event.
-      *
-      * @return The new event.
-      */
-     EventTimeCallback* add_time_callback(simtime time,
-                                          std::function<void (void)> function,
-                                          int priority = PRIORITY_TIMECALLBACK);
-
-     /**
-      * @brief Add a breakpoint. Breakpoints are only active when single
-      * stepping.
-      *
-      * @return The new breakpoint.
-      */
-     Breakpoint* add_breakpoint();
-
-     /**
-      * @brief Delete a breakpoint.
-      *
-      * @param breakpoint The breakpoint to delete.
-      */
-     void delete_breakpoint(Breakpoint *breakpoint);
-
-     /**
-      * @brief Get a breakpoint.
-      *
-      * @param index The index of the breakpoint to get.
-      *
-      * @return The breakpoint at the given index.
-      */
-     Breakpoint* get_breakpoint(int index) const;
-
-     /**
-      * @brief Check and set breakpoints to all events in the event list.
-      */
-     void update_breakpoints();
-
-     /**
-      * @brief Toggle breakpoint on event in the event list.
-      *
-      * @param index The index of the event to the toggle the breakpoint on.
-      * @param value True turns the breakpoint on.
-      */
-     void set_breakpoint(int index, bool value);
-
-     /**
-      * @brief Toggle breakpoints on or off.
-      *
-      * @param value True turns on breakpoints.
-      */
-     void set_breakpoints_enabled(bool value);
-
-     /**
-      * @brief Set event that should stop the simulation. Works only for single
-      * stepping.
-      *
-      * @param index The index to the event in the event list to stop on.
-      */
-     void set_stop_event(int index);
-
-      /**
-      * @brief Clear the stop event.
-      */
-     void clear_stop_event();
-
-     /**
-      * @brief Get the random number generator used by the simulation.
-      *
-      * @return The random number generator.
-      */
-     RandomGenerator& random_generator() const;
-
-     /**
-      * @brief Get the number of simulation replications.
-      *
-      * @return The number of replications.
-      */
-     unsigned int replications() const;
-
-     /**
-      * @return The current, zero based, replication index.
-      */
-     unsigned int replication() const;
-
-     /**
-      * @brief Get the warmup period.
-      *
-      * @return The warmup period in seconds.
-      */
-     simtime warmup() const;
-
-     /**
-      * @brief Get the horizon.
-      *
-      * @return The horizon in seconds.
-      */
-     simtime horizon() const;
-
-     /**
-      * @brief Cancels the simulation.
-      *
-      * Cancels the simulation before the next event when using 'simulate_step'
-      * and after the simulation is finished when using 'simulate', canceling
-      * any remaining replications.
-      */
-     void cancel_simulation();
-
-     /**
-      * @brief Check if the simulation has been canceled.
-      *
-      * @return True if the simulation is canceled.
-      */
-     bool simulation_canceled() const;
-
-     /**
-      * @brief Add a new active period.
-      *
-      * Active periods are used to calculate shifting bottlenecks.
-      *
-      * @param node The node that the active period refers to.
-      * @param start The start time of the active period.
-      * @param end The end time of the active period.
-      * @param open_end True if the active period have not yet ended.
-      */
-     void add_active_period(Node* node, double start, double end, bool open_end);
-
-     /**
-      * @brief Check if the shifting bottleneck detection is on.
-      *
-      * @return True if it is on.
-      */
-     bool shifting_bottleneck_detection() const;
-
-     /**
-      * @brief Turns shifting bottleneck detection on or off.
-      *
-      * @param value True if it should be used.
-      */
-     void set_shifting_bottleneck_detection(bool value);
-
-     /**
-      * @brief Calculates the shifting bottlenecks.
-      *
-      * @param remove_periods If true active periods are removed from the
-      * active period list when used. This must be used if this function is
-      * called multiple times within one simulation.
-      *
-      * @note Set 'remove_periods' to false if there is no need for online
-      * bottleneck statistics, i.e. if it is only run once at the end of the
-      * simulation, because it much faster that way.
-      */
-     void calculate_shifting_bottlenecks(bool remove_periods = true);
-
-     /**
-      * @brief Get the node that is determined to be the bottleneck.
-      *
-      * @return The node that is the bottleneck.
-      */
-     Node* bottleneck();
-
-     /**
-      * @brief Get the skill id with a given name.
-      *
-      * @return If found it returns the skill id, otherwise -1.
-      */
-     int get_skill_id(std::string name) const;
-
-     /**
-      * @brief Get the root component.
-      *
-      * @returns The root component.
-      */
-     Component* root_component() const;
-
-     /**
-      * @brief Gets the next batch identifier
-      *
-      * The batch id is guaranteed to be unique.
-      *
-      * @returns The next batch identifier.
-      */
-     unsigned int get_next_batch_id();
-
-     /**
-      * @brief Gets all objects that are of a specific type.
-      *        
-      * @note This will return all objects that can be cast to T. So a call to
-      * "polymorphic_objects<Node>()" will return all objects that are of type Node.
-      *
-      * @tparam T The type to search for.
-      * @param recursive True to search recursively, false to search the root component only.
-      * @param include_templates True to include templates in the search, false to exclude them.
-      *
-      * @return Objects of type T.
-      */
-     template<typename T>
-     std::vector<T*> polymorphic_objects(bool recursive = true,
-                                         bool include_templates = false) const
-     {
-         if (!root_component_)
-             return std::vector<T*>();
-
-         std::vector<T*> objects = root_component_->polymorphic_objects<T>(recursive);
-
-         if (include_templates) {
-             for (Component* component : templates()) {
-                 std::vector<T*> template_objects = component->polymorphic_objects<T>(recursive);
-                 objects.insert(objects.end(), template_objects.begin(), template_objects.end());
-             }
-         }
-
-         return objects;
-     }
-
-     /**
-      * @brief Gets all objects that are of a specified class.
-      *
-      * @note Will only return objects that are of the exact same class.
-      *
-      * @tparam T The class type that should be returned.
-      *
-      * @return Objects of type T.
-      */
-     template<typename T>
-     std::vector<T*> class_objects(bool recursive = true) const
-     {
-         return root_component_->class_objects<T>(recursive);
-     }
-
-     /**
-      * @brief Gets all objects of a specific object type.
-      *
-      * This function only returns objects that have the exact same object
-      * type.
-      *
-      * @param  type The object type that should be returned.
-      *
-      * @returns All objects that matches the specified object type.
-      */
-     std::vector<Object*> type_objects(const std::string& type) const;
-
-     /**
-      * @brief Searches for an object with a specified id.
-      *
-      * @tparam T The class to object should be cast to.
-      * @param  id                The identifier.
-      * @param  recursive         True to search recursively, false to search the root component only.
-      * @param  include_templates True to include templates in the search, false to exclude them.
-      *
-      * @returns The object cast to the specified type, or nullptr if the object is not found or it is
-      *          of the wrong type.
-      */
-     template <typename T = Object>
-     T* find_object_by_id(const std::string & id,
-                          bool recursive = true,
-                          bool include_templates = false) const
-     {
-         T* object = root_component_->find_object_by_id<T>(id, recursive);
-
-         if (!object && include_templates) {
-             for (Component* component : templates()) {
-                 object = component->find_object_by_id<T>(id, recursive);
-                 if (object)
-                     break;
-             }
-         }
-
-         return object;
-     }
-
-     /**
-      * @brief Searches for an object with a specified name.
-      *
-      * @tparam T The class to object should be cast to.
-      * @param  name              The name.
-      * @param  recursive         True to search recursively, false to search the root component only.
-      * @param  include_templates True to include templates in the search, false to exclude them.
-      *
-      * @returns The object cast to the specified type, or nullptr if the object is not found or it is
-      *          of the wrong type.
-      */
-     template <typename T = Object>
-     T* find_object_by_name(const std::string& name,
-                          bool recursive = true,
-                          bool include_templates = false) const
-     {
-         T* object = root_component_->find_object_by_name<T>(name, recursive);
-
-         if (!object && include_templates) {
-             for (Component* component : templates()) {
-                 object = component->find_object_by_name<T>(name, recursive);
-                 if (object)
-                     break;
-             }
-         }
-
-         return object;
-     }
-
-     /**
-      * @brief Returns the location (node) where each entity currently is.
-      *
-      * @return All entities and their respective locations.
-      */
-     std::vector<EntityLocation> entity_locations() const;
-
-     /**
-      * @brief Get the average cycle time of all variants.
-      *
-      * @return The cycle time.
-      */
-     simtime cycle_time() const;
-
-     /**
-      * @brief Get the average work in process of all nodes.
-      *
-      * @return The average work in process.
-      */
-     double wip() const;
-
-     /**
-      * @brief Get the throughput of the model.
-      *
-      * @return The throughput.
-      */
-     double throughput() const;
-
-     /**
-      * @brief Get the total number of entities that have exited the
-      * model.
-      *
-      * @return Total exits.
-      */
-     unsigned int total_exits() const;
-
-     /**
-      * @brief Get all throughput values from each replication.
-      *
-      * @return Throughput replications.
-      */
-     std::vector<double> throughput_replications() const;
-
-     /**
-      * @brief Get all work in process values from each replication.
-      *
-      * @return Work in process replications.
-      */
-     std::vector<double> wip_replications() const;
-
-     /**
-      * @brief Get all cycle time values from each replication.
-      *
-      * @return Cycle time replications.
-      */
-     std::vector<double> cycle_time_replications() const;
-
-     /**
-      * @brief Get all total exits from each replication.
-      *
-      * @return Total exits replications.
-      */
-     std::vector<double> total_exits_replications() const;
-
-     /**
-      * @brief Facilitates communication between the simulation and external receivers.
-      *
-      * Write data to the ostream with the '<<' operator and end by writing 'std::endl'. The
-      * 'std::endl' will flush the ostream and trigger the log_changed signal that external
-      * receivers can subscribe to.
-      *
-      * @return The log output stream.
-      */
-     std::ostream& log() const;
-
-     /**
-      * @brief Add a simulation output.
-      *
-      * Each @p name should have one @p value for each simulation replication.
-      *
-      * @param name The name of the output.
-      * @param value The value of the output.
-      */
-     void add_output(const std::string &name, double value);
-
-     /**
-      * @return All simulation output names and their respective values.
-      */
-     const std::map<std::string, std::vector<double>>& get_output_replications() const;
-
-     XSimLLVM* jit() const;
-
-	 void save_module_file(const std::string &module_name, const std::string &code);
-     void save_internal_file(const std::string &module_name, const std::string &code);
-     void parse_modules(const std::string &code);
-	 void submit_code(std::string text, std::string name);
-     const std::vector<std::string>& get_modules() const;
-     const std::vector<std::string>& get_internal_files() const;
-
-     /**
-      * @brief Gets the start time of the simulation
-      *
-      * @returns The start time of the simulation.
-      */
-     std::chrono::system_clock::time_point start_time_point() const;
-
-     /**
-      * @brief Gets the the small size allocator
-      *
-      * @returns A reference to a PoolAllocator.
-      */
-     PoolAllocator<128>& allocator() { return allocator_; }
-
- private:
-     /** @brief Private default constructor */
-     Simulation() = delete;
-
-     Simulation(const std::string & source_dir, const std::string & lib_dir, const std::string & build_dir);
-    
-
-     /** @brief The Simulation instance */
-     inline static Simulation* instance_ = nullptr;
-
-     /** @brief Creates the root component */
-     void create_root_component();
-
-     /**
-      * @brief A log buffer that stores the intermediate data written the log stream.
-      */
-     LogBuffer *log_buf_;
-
-     /**
-      * @brief The output stream used for logging simulation messages.
-      */
-     std::ostream *log_stream_;
-
-     /**
-      * @brief Starts the simulation.
-      *
-      * @param time The simulation stop time.
-      * @param replications The number of replications to perform.
-      */
-     void simulate(simtime time, int replications = 1);
-
-     /**
-      * @brief Insert an event.
-      *
-      * Time of the event is implicitly decided by the start event, whenever
-      * that event is scheduled to happen that is the time the insert event
-      * will also have. The inserted event can also not be scheduled before
-      * the start event.
-      *
-      * @param start The event after which the new event should be inserted.
-      * @param insert The event that should be inserted.
-      */
-     void insert_event(Event *start, Event *insert);
-
-     /**
-      * @brief Insert an event directly after another event.
-      *
-      * Time of the event is implicitly decided by the first event, whenever
-      * that event is scheduled to happen that is the time the insert event
-      * will also have.
-      *
-      * @param evt The event after which the new event should be inserted.
-      * @param insert The event that should be inserted.
-      */
-     void insert_event_after(Event *evt, Event *insert);
-
-     /**
-      * @brief Free all events from the event list.
-      */
-     void free_events();
-
-     /**
-      * @brief Process the event list until there are no more events or the
-      * simulation stop time is reached.
-      *
-      * @param time The simulation stop time.
-      */
-     void simulate_events(simtime time);
-
-     /**
-      * @brief Check if event matches any breakpoints.
-      *
-      * @param evt The event to set breakpoint on.
-      */
-     void check_breakpoints(Event *evt);
-
-     /**
-      * @brief Saves a event to a file.
-      *
-      * @param evt The event to save.
-      */
-     void trace(Event *evt, std::ofstream &trace_file);
-
-     /**
-      * @brief A global counter to keep all batch ids unique.
-      */
-     unsigned int batch_id_;
-
-     /**
-      * @brief Store different statistics for each replication.
-      */
-     std::vector<double> total_exits_replications_;
-     std::vector<double> throughput_replications_;
-     std::vector<simtime> cycle_time_replications_;
-     std::vector<double> wip_replications_;
-     std::map<std::string, std::vector<double>> output_replications_;
-
-     /**
-      * @brief The simulation horizon that is read from the xml file.
-      */
-     simtime horizon_;
-
-     /**
-      * @brief The simulation warmup that is read from the xml file.
-      */
-     simtime warmup_;
-
-     /**
-      * @brief The number of replications that is read from the xml file.
-      */
-     unsigned int replications_;
-
-     /**
-      * @brief The current replication index.
-      */
-     unsigned int replication_;
-
-     /**
-      * @brief The random generator used to generate all random numbers. This
-      * is the only allowed generator, no other generator should be used
-      * throughout the entire simulation.
-      */
-     RandomGenerator *rng_;
-
-     /**
-      * @brief Set to true to cancel the simulation.
-      */
-     bool simulation_canceled_;
-
-     /**
-      * @brief The current simulation time.
-      */
-     simtime simclock_;
-
-     /**
-      * @brief Set to true if shifting bottleneck detection should be used.
-      */
-     bool shifting_bottleneck_detection_;
-
-     /**
-      * @brief All active periods stored be per node.
-      */
-     std::map<Node*, std::vector<ActivePeriod*>> active_periods_;
-
-     /**
-      * @brief The event queue.
-      */
-     //EventQueue events_;
-     std::map<double, Event*> events_;
-
-     Event *current_event_;
-
-     /**
-      * @brief The root component that contains all objects.
-      */
-     Component *root_component_;
-
-     /**
-      * @brief All managed nodes.
-      */
-     std::vector<std::string> skill_ids_;
-     std::vector<Component*> templates_;
-     std::vector<Variable*> variables_;
-
-     /**
-      * @brief All breakpoints.
-      */
-     std::list<Breakpoint*> breakpoints_;
-
-     /**
-      * @brief True if breakpoints are active.
-      */
-     bool breakpoints_active_;
-
-     /**
-      * @brief The event to stop on. Works only for single stepping.
-      */
-     Event *stop_event_;
-
-     /** @brief The start time point of the simulation */
-     std::chrono::system_clock::time_point start_time_point_;
-
-     /** @brief A custom pool allocator */
-     PoolAllocator<128> allocator_;
-
-     XSimLLVM *jit_;
-
-	 std::string source_dir_;
-	 std::string build_dir_;
-	 std::string lib_dir_;
-     std::vector<std::string> modules_;
-     std::vector<std::string> internal_files_;
-     //std::vector<std::pair<std::string, std::string>> modules_;
-
-     /**
-      * @brief The user data that was sent into the simulation.
-      */
-     std::string user_data_input_;
-
-     /**
-      * @brief The user data, one for each replication, that is produced in the simulation.
-      */
-     std::vector<std::string> user_data_output_;
-};
-
-constexpr auto sim = &Simulation::instance;
-
-} // namespace xsim
-
-#endif // SIMULATION_H
+﻿#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <xsim_config>
+#include <chrono>
+#include <limits>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include <functional>
+#include <typeinfo>
+#include <unordered_map>
+#include <sstream>
+#include <random>
+
+#include "date/date.h"
+#include "date/iso_week.h"
+
+#include "common.h"
+#include "component.h"
+#include "disruptionwalk.h"
+#include "entitysidetable.h"
+#include "eventinfo.h"
+#include "expression.h"
+#include "modulecache.h"
+#include "object.h"
+#include "prioritysignal.h"
+#include "poolallocator.h"
+#include "stringtable.h"
+#include "variable.h"
+#include "wakeupindex.h"
+
+#pragma warning(disable : 4996)
+
+namespace xsim {
+
+class ActivePeriod;
+class Assembly;
+class Batch;
+class Buffer;
+class Breakpoint;
+class CriticalWip;
+class Conveyor;
+class Demand;
+class ExitPort;
+class Event;
+class Disassembly;
+class EventTimeCallback;
+class Facade;
+class Kanban;
+class FailureZone;
+class FramePublisher;
+class LogBuffer;
+class MaxWip;
+class Entity;
+class Node;
+class Order;
+class Operation;
+class ParallelOperation;
+class Takt;
+class NumberGenerator;
+class ShiftCalendar;
+class Sink;
+class XSimLLVM;
+class Source;
+class Store;
+class Variant;
+class Skill;
+class ResourceManager;
+
+typedef std::mt19937 RandomGenerator;
+
+/**
+ * @brief The simulation manager.
+ *
+ * Creates and owns all simulation objects and performs the simulation of the
+ * events.
+ */
+class XSIM_EXPORT Simulation {
+ typedef std::function<void (void)> TimeCallback;
+
+ public:
+     typedef std::pair<Node*, Entity*> EntityLocation;
+
+     PrioritySignal<void()> simulation_initialized;
+     PrioritySignal<void()> simulation_finalized;
+     PrioritySignal<void()> initialized;
+     PrioritySignal<void()> finalized;
+     PrioritySignal<void()> statistics_reset;
+     Signal<void (const std::string &)> log_changed;
+
+     /**
+      * @brief Deleted copy constructor
+      */
+     Simulation(Simulation const&) = delete;
+
+     /**
+      * @brief Deleted assignment operator
+      */
+     void operator=(Simulation const&) = delete;
+
+     /** @brief Destructor */
+     ~Simulation();
+
+     /** @brief Creates the Simulation instance */
+     static void create_instance(const std::string& source_dir, const std::string& lib_dir, const std::string& build_dir);
+
+     /** @brief Destroys the Simulation instance */
+     static void destroy_instance();
+
+     /** @returns The simulation instance. */
+     static Simulation* instance();
+
+     /** @brief Clears the simulation to its blank/initial state */
+     void clear();
+
+     /**
+      * @brief Sets the seed to the random number generator
+      *
+      * @param  seed The seed.
+      */
+     void set_seed(int seed);
+
+     /**
+      * @brief Attaches the given @p data to the simulation input.
+      *
+      * This function should only be used to transfer user data into the simulation instance. It
+      * will not update the input user data stored in the database. Instead use @ref
+      * set_user_data_output to store user data for later use.
+      *
+      * @param data The data to save.
+      */
+     void set_user_data_input(const std::string& data);
+
+     /**
+      * @return The user data set with @ref set_user_data_input.
+      */
+     std::string user_data_input() const;
+
+     /**
+      * @brief Attaches the given @p data to the simulation output.
+      *
+      * Stores any user data in the database for later use.
+      *
+      * @param data The data to save.
+      */
+     void set_user_data_output(const std::string& data);
+
+     /**
+      * @param replication The replication index, zero based, to get user data for.
+      *
+      * @return The user data set with @ref set_user_data_output.
+      */
+     std::string user_data_output(int replication) const;
+
+     /**
+      * @brief Initialize the simulation.
+      *
+      * The variant indices are final at this point, objects size their per
+      * variant tables for variants().size() so no lookup allocates while simulating.
+      */
+     void simulation_init();
+
+     /** @brief Finalize the simulation. */
+     void simulation_finalize();
+
+     /**
+      * @brief Initialize the simulation objects at the start of a simulation replication.
+      *        
+      *        This function must be called before 'simulate' or the first call to 'simulate_step'.
+      *        It's should not be called before 'run'.
+      */
+     void init();
+
+     /** @brief Finalize the simulation objects at the end of a simulation replication. */
+     void finalize();
+
+     /**
+      * @brief Sets the start time point of the simulation.
+      *
+      * @param  start_date The new start time point of the simulation.
+      */
+     void set_start_time_point(std::chrono::system_clock::time_point start_date);
+
+     /**
+      * @returns The current simulation time as a time point.
+      */
+     std::chrono::system_clock::time_point time_point_now() const;
+
+     /**
+      * @returns The year, month and day of the current simulation time.
+      */
+     date::year_month_day year_month_day() const;
+
+     /**
+      * @returns The year and month of the current simulation time.
+      */
+     date::year_month year_month() const;
+
+     /**
+      * @returns The number of days since the simulation start.
+      */
+     date::sys_days days() const;
+
+     /**
+      * @returns The year of the current simulation time.
+      */
+     date::year year() const;
+
+     /**
+      * @returns The month of the current simulation time.
+      */
+     date::month month() const;
+
+     /**
+      * @returns The day of the current simulation time.
+      */
+     date::day day() const;
+
+     /**
+      * @returns The week number of the current simulation time.
+      */
+     iso_week::weeknum week() const;
+
+     /**
+      * @returns The day of week of the current simulation time.
+      */
+     date::weekday day_of_week() const;
+
+     /**
+      * @returns The time of day, in seconds, of the current simulation time.
+      */
+     std::chrono::duration<float> time_of_day() const;
+
+     /**
+      * @brief Get the current simulation time.
+      *
+      * @return The current simulation time.
+      */
+     simtime now() const;
+
+     /**
+      * @brief Get the elapsed time with the warm-up period removed.
+      *
+      * @returns The elapsed time.
+      */
+     simtime elapsed_time() const;
+
+     /**
+      * @brief Schedules an event for execution.
+      *
+      * @param evt The event that should be executed.
+      * @param time The time when the event should be executed, relative to the
+      * current simulation time.
+      */
+     void schedule(Event *evt, simtime time);
+
+     /**
+      * @brief Schedule an event directly before another event.
+      *
+      * @param evt The event that should be exectuted.
+      * @param insert The event before which the new event should be inserted.
+      * @param time The time when the event should be executed, relative to the
+      * current simulation time.
+      */
+     void schedule_before(Event *evt, Event *insert, simtime time);
+
+     /**
+      * @brief Schedules an event for immediate execution.
+      *
+      * @param evt The event that should be executed.
+      */
+     void schedule_now(Event *evt);
+
+     /**
+      * @brief Remove event from event list.
+      *
+      * @param evt The event to remove.
+      */
+     void remove_event(Event *evt);
+
+     /**
+      * @returns  The event that is currently being processed.
+      */
+     const Event* current_event() const;
+
+     /**
+      * @brief Executes one simulation event.
+      *
+      * @return The state of simulation.
+      */
+     int simulate_step();
+
+     /**
+      * @brief Reset statistics collected during the warmup period.
+      */
+     void reset_stats();
+
+     /**
+      * @brief Get the event list.
+      *
+      * @return The current event list.
+      */
+     std::vector<EventInfo> event_list();
+
+     /**
+      * @brief Get a window of the event list, starting at a position.
+      *
+      * Fills @p snapshot with at most @p count events, starting with the event
+      * at position @p first in the event list. The vector is cleared but keeps
+      * its capacity, so polling with the same vector does not allocate.
+      *
+      * @param snapshot The vector to fill.
+      * @param first    The zero-based position of the first event.
+      * @param count    The maximum number of events.
+      *
+      * @return The number of events written to the snapshot.
+      */
+     size_t event_list_snapshot(std::vector<EventSnapshot>& snapshot,
+                                size_t first,
+                                size_t count);
+
+     /**
+      * @brief Get a window of the event list, limited by time.
+      *
+      * Fills @p snapshot with the events that are scheduled within [@p from,
+      * @p to]. The first event is located through the time index, so only
+      * the events in the window are visited.
+      *
+      * @param snapshot The vector to fill.
+      * @param from     The start of the time window.
+      * @param to       The end of the time window.
+      * @param count    The maximum number of events.
+      *
+      * @return The number of events written to the snapshot.
+      */
+     size_t event_list_snapshot_window(std::vector<EventSnapshot>& snapshot,
+                                       simtime from,
+                                       simtime to,
+                                       size_t count = std::numeric_limits<size_t>::max());
+
+     /**
+      * @return The number of events in the event list.
+      */
+     size_t event_count() const { return event_count_; }
+
+     /**
+      * @brief Run without animation.
+      *
+      * In headless mode all animation and other visual only work is skipped: visual events,
+      * see Event::is_visual, are not scheduled, animation signals are not emitted and animation
+      * states are not allocated. Meant for batch experiments, the results are the same. Always
+      * on for a headless build, see XSIM_HEADLESS_BUILD in xsim_config.
+      *
+      * @param value True to run headless.
+      */
+     void set_headless(bool value);
+
+     /**
+      * @return True if the simulation runs headless.
+      */
+     bool headless() const { return HEADLESS_BUILD || headless_; }
+
+     /**
+      * @brief Record a visual event that was not scheduled because the simulation is headless.
+      *
+      * Called where the event would have been scheduled, once for each skipped schedule.
+      */
+     void count_skipped_visual_event() { ++skipped_visual_events_; }
+
+     /**
+      * @return The number of visual events skipped in headless mode since the simulation was
+      * initialized.
+      */
+     uint64_t skipped_visual_events() const { return skipped_visual_events_; }
+
+     /**
+      * @brief Keep the work in progress of each node on a clock of its own.
+      *
+      * Out, setup, assemble and disassemble events are then scheduled in node
+      * local time, see Node::schedule_local, and a node that fails, pauses or
+      * goes unplanned freezes its clock instead of canceling these events and
+      * rescheduling them with their remaining time when it resumes. A stop
+      * then costs the same however much work is pending on the node. Must be
+      * set before the simulation is initialized.
+      *
+      * @param value True to use virtual node clocks.
+      */
+     void set_virtual_node_clocks(bool value) { virtual_node_clocks_ = value; }
+
+     /**
+      * @return True if nodes use virtual clocks.
+      */
+     bool virtual_node_clocks() const { return virtual_node_clocks_; }
+
+     /**
+      * @brief Publish animation frames to a shared memory segment.
+      *
+      * Every @p interval seconds of simulated time a frame with the node states, the entity
+      * locations and the offsets of the entities on conveyors is written to the segment, see
+      * FramePublisher. A viewer process reads the frames with FrameReader instead of calling
+      * entity_locations, Node::state and Conveyor::get_conveyor_state on the simulation thread.
+      * Frames are visual events and are not published when the simulation runs headless.
+      *
+      * @param name         The name of the shared memory segment.
+      * @param interval     The simulated time between frames in seconds.
+      * @param max_entities The maximum number of entities in a frame.
+      * @param slots        The number of frame buffers, two or three.
+      *
+      * @return True if the segment was created.
+      */
+     bool start_frame_publisher(const std::string& name,
+                                simtime interval,
+                                uint32_t max_entities = 65536,
+                                uint32_t slots = 3);
+
+     /**
+      * @brief Stop publishing frames and remove the shared memory segment.
+      */
+     void stop_frame_publisher();
+
+     /**
+      * @return The frame publisher, or nullptr if frames are not published.
+      */
+     FramePublisher* frame_publisher() const { return frame_publisher_; }
+
+     /**
+      * @brief Write the current state of the model as a frame, called by EventPublishFrame.
+      */
+     void publish_frame();
+
+     /**
+      * @brief Get the next event to be processed.
+      *
+      * @return The current event.
+      */
+     EventInfo next_event();
+
+     /**
+      * @brief Loads a model from an xml string.
+      *
+      * @param xml The xml string with the model to load.
+      */
+     void load_from_string(std::string xml_str);
+
+     /**
+      * @brief Loads a model from an xml file.
+      *
+      * @param filename The xml file containing the model to load.
+      */
+     void load_from_file(std::string filename);
+
+     void init_simulation(std::string filename);
+
+     /**
+      * @brief Saves the model to a xml file.
+      *
+      * @param  filename The xml file where the model will be saved.
+      */
+     void save_model(const std::string& filename);
+
+     /**
+      * @brief Saves the model to a xml formatted string
+      *
+      * @returns A xml formatted string.
+      */
+     std::string save_model();
+
+     /**
+      * @brief Set warmup period.
+      *
+      * @param time The warmup period in seconds.
+      */
+     void set_warmup(simtime time);
+
+     /**
+      * @brief Set simulation horizon.
+      *
+      * @param time The simulation horizon in seconds.
+      */
+     void set_horizon(simtime time);
+
+     /**
+      * @brief Set the number of simulation replications.
+      *
+      * @param replications The number of replications.
+      */
+     void set_replications(unsigned int replications);
+
+     /**
+      * @brief Starts the simulation and writes the results to a file.
+      *
+      * @param filename The file that the output (xml) of the simulation is
+      * written to.
+      */
+     void run(std::string filename);
+
+     /**
+      * @brief Starts the simulation and returns the results as a string.
+      *
+      * @return An xml string containing the results of the simulation.
+      */
+     std::string run();
+
+     /**
+      * @brief Adds a template
+      *
+      * @param component The template component to add.
+      */
+     void add_template(Component* component);
+
+     /**
+      * @brief Adds a variable.
+      *
+      * @param  name      The name of the variable.
+      * @param  id        The identifier.
+      * @param  data_type Type of the data.
+      * @param  value     The value.
+      */
+     void add_variable(
+            const std::string& name,
+            const std::string& id,
+            const std::string& data_type,
+            const std::string& value);
+
+     /**
+      * @returns All variables.
+      */
+     const std::vector<Variable*>& variables() const;
+
+     /**
+      * @brief Gets a variable.
+      *
+      * The variables are indexed by id, so the lookup does not depend on the number of variables.
+      *
+      * @param  id The identifier of the variable.
+      *
+      * @returns The variable if found, otherwise nullptr.
+      */
+     Variable* get_variable(const std::string& id) const;
+
+     /**
+      * @brief Sets the value of a variable.
+      *
+      * Only the Double and Int parameters whose expressions read the variable are re-evaluated.
+      *
+      * @param  id    The identifier of the variable.
+      * @param  value The new value.
+      *
+      * @returns The number of re-evaluated expressions, or -1 if the variable is not found.
+      */
+     int set_variable(const std::string& id, double value);
+
+     /**
+      * @brief Sets the value of a variable without looking it up.
+      *
+      * @param  variable The variable.
+      * @param  value    The new value.
+      *
+      * @returns The number of re-evaluated expressions.
+      */
+     int set_variable(Variable* variable, double value);
+
+     /**
+      * @brief Removes and deletes a variable.
+      *
+      * The expressions that read the variable keep its current value, see
+      * ExpressionCompiler::variable_removed.
+      *
+      * @param  id The identifier of the variable.
+      *
+      * @returns True if the variable was found.
+      */
+     bool remove_variable(const std::string& id);
+
+     /**
+      * @brief Gets the compiler of Double and Int expressions.
+      *
+      * @returns A reference to the ExpressionCompiler.
+      */
+     ExpressionCompiler& expressions() { return expressions_; }
+
+     /**
+      * @returns All template components.
+      */
+     const std::vector<Component*>& templates() const;
+
+     /**
+      * @brief Adds a skill to the model.
+      *
+      * @param name The name of the skill.
+      */
+     void add_skill(std::string name);
+
+     /**
+      * @returns All skills.
+      */
+     const std::vector<std::string>& skills() const;
+
+     /**
+      * @brief Add a callback that gets called at a specified simulation time.
+      *
+      * @param time The simulation time when the callback should occur.
+      * @param callback The function to call.
+      * @param priority The priority of the event.
+      *
+      * @return The new event.
+      */
+     EventTimeCallback* add_time_callback(simtime time,
+                                          std::function<void (void)> function,
+                                          int priority = PRIORITY_TIMECALLBACK);
+
+     /**
+      * @brief Add a breakpoint. Breakpoints are only active when single
+      * stepping.
+      *
+      * @return The new breakpoint.
+      */
+     Breakpoint* add_breakpoint();
+
+     /**
+      * @brief Delete a breakpoint.
+      *
+      * @param breakpoint The breakpoint to delete.
+      */
+     void delete_breakpoint(Breakpoint *breakpoint);
+
+     /**
+      * @brief Get a breakpoint.
+      *
+      * @param index The index of the breakpoint to get.
+      *
+      * @return The breakpoint at the given index.
+      */
+     Breakpoint* get_breakpoint(int index) const;
+
+     /**
+      * @brief Check and set breakpoints to all events in the event list.
+      */
+     void update_breakpoints();
+
+     /**
+      * @brief Toggle breakpoint on event in the event list.
+      *
+      * @param index The index of the event to the toggle the breakpoint on.
+      * @param value True turns the breakpoint on.
+      */
+     void set_breakpoint(int index, bool value);
+
+     /**
+      * @brief Toggle breakpoints on or off.
+      *
+      * @param value True turns on breakpoints.
+      */
+     void set_breakpoints_enabled(bool value);
+
+     /**
+      * @brief Set event that should stop the simulation. Works only for single
+      * stepping.
+      *
+      * @param index The index to the event in the event list to stop on.
+      */
+     void set_stop_event(int index);
+
+      /**
+      * @brief Clear the stop event.
+      */
+     void clear_stop_event();
+
+     /**
+      * @brief Get the random number generator used by the simulation.
+      *
+      * @return The random number generator.
+      */
+     RandomGenerator& random_generator() const;
+
+     /**
+      * @brief Get the seed of the private variate streams of the number generators.
+      *
+      * Changes when the seed is set and for every replication, buffered
+      * variates drawn with another seed are discarded.
+      *
+      * @return The seed.
+      */
+     uint64_t variate_seed() const { return variate_seed_; }
+
+     /**
+      * @brief Allocates a private variate stream for a number generator.
+      *
+      * The stream is derived from the id of the generator, so a generator
+      * draws the same values each time the model is loaded, whatever order
+      * the generators are created in and whatever generators are added or
+      * removed. Generators that share an id, as the generators of copied
+      * nodes do, get the stream of the id followed by one more stream per
+      * copy in the order they are allocated. Generators without an id are
+      * numbered in the order they are allocated, in a range that does not
+      * overlap the derived streams.
+      *
+      * @param id The id of the number generator.
+      *
+      * @return The stream index.
+      */
+     uint64_t allocate_variate_stream(std::string_view id)
+     {
+         const uint64_t unnamed = uint64_t(1) << 63;
+         if (id.empty())
+             return unnamed | variate_streams_++;
+         uint64_t hash = 0xcbf29ce484222325ull;
+         for (char c : id)
+             hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+         hash &= ~unnamed;
+         uint64_t copy = variate_stream_copies_[hash]++;
+         if (copy == 0)
+             return hash;
+         for (int i = 0; i < 8; ++i, copy >>= 8)
+             hash = (hash ^ (copy & 0xff)) * 0x100000001b3ull;
+         return hash & ~unnamed;
+     }
+
+     /**
+      * @brief Get the number of simulation replications.
+      *
+      * @return The number of replications.
+      */
+     unsigned int replications() const;
+
+     /**
+      * @return The current, zero based, replication index.
+      */
+     unsigned int replication() const;
+
+     /**
+      * @brief Get the warmup period.
+      *
+      * @return The warmup period in seconds.
+      */
+     simtime warmup() const;
+
+     /**
+      * @brief Get the horizon.
+      *
+      * @return The horizon in seconds.
+      */
+     simtime horizon() const;
+
+     /**
+      * @brief Cancels the simulation.
+      *
+      * Cancels the simulation before the next event when using 'simulate_step'
+      * and after the simulation is finished when using 'simulate', canceling
+      * any remaining replications.
+      */
+     void cancel_simulation();
+
+     /**
+      * @brief Check if the simulation has been canceled.
+      *
+      * @return True if the simulation is canceled.
+      */
+     bool simulation_canceled() const;
+
+     /**
+      * @brief Add a new active period.
+      *
+      * Active periods are used to calculate shifting bottlenecks.
+      *
+      * @param node The node that the active period refers to.
+      * @param start The start time of the active period.
+      * @param end The end time of the active period.
+      * @param open_end True if the active period have not yet ended.
+      */
+     void add_active_period(Node* node, double start, double end, bool open_end);
+
+     /**
+      * @brief Check if the shifting bottleneck detection is on.
+      *
+      * @return True if it is on.
+      */
+     bool shifting_bottleneck_detection() const;
+
+     /**
+      * @brief Turns shifting bottleneck detection on or off.
+      *
+      * @param value True if it should be used.
+      */
+     void set_shifting_bottleneck_detection(bool value);
+
+     /**
+      * @brief Calculates the shifting bottlenecks.
+      *
+      * @param remove_periods If true active periods are removed from the
+      * active period list when used. This must be used if this function is
+      * called multiple times within one simulation.
+      *
+      * @note Set 'remove_periods' to false if there is no need for online
+      * bottleneck statistics, i.e. if it is only run once at the end of the
+      * simulation, because it much faster that way.
+      */
+     void calculate_shifting_bottlenecks(bool remove_periods = true);
+
+     /**
+      * @brief Get the node that is determined to be the bottleneck.
+      *
+      * @return The node that is the bottleneck.
+      */
+     Node* bottleneck();
+
+     /**
+      * @brief Get the skill id with a given name.
+      *
+      * @return If found it returns the skill id, otherwise -1.
+      */
+     int get_skill_id(std::string name) const;
+
+     /**
+      * @brief Get the root component.
+      *
+      * @returns The root component.
+      */
+     Component* root_component() const;
+
+     /**
+      * @brief Gets the next batch identifier
+      *
+      * The batch id is guaranteed to be unique.
+      *
+      * @returns The next batch identifier.
+      */
+     unsigned int get_next_batch_id();
+
+     /**
+      * @brief Gets all objects that are of a specific type.
+      *        
+      * @note This will return all objects that can be cast to T. So a call to
+      * "polymorphic_objects<Node>()" will return all objects that are of type Node.
+      *
+      * @tparam T The type to search for.
+      * @param recursive True to search recursively, false to search the root component only.
+      * @param include_templates True to include templates in the search, false to exclude them.
+      *
+      * @return Objects of type T.
+      */
+     template<typename T>
+     std::vector<T*> polymorphic_objects(bool recursive = true,
+                                         bool include_templates = false) const
+     {
+         if (!root_component_)
+             return std::vector<T*>();
+
+         std::vector<T*> objects = root_component_->polymorphic_objects<T>(recursive);
+
+         if (include_templates) {
+             for (Component* component : templates()) {
+                 std::vector<T*> template_objects = component->polymorphic_objects<T>(recursive);
+                 objects.insert(objects.end(), template_objects.begin(), template_objects.end());
+             }
+         }
+
+         return objects;
+     }
+
+     /**
+      * @brief Gets all objects that are of a specified class.
+      *
+      * @note Will only return objects that are of the exact same class.
+      *
+      * @tparam T The class type that should be returned.
+      *
+      * @return Objects of type T.
+      */
+     template<typename T>
+     std::vector<T*> class_objects(bool recursive = true) const
+     {
+         return root_component_->class_objects<T>(recursive);
+     }
+
+     /**
+      * @brief Gets all objects of a specific object type.
+      *
+      * This function only returns objects that have the exact same object
+      * type.
+      *
+      * @param  type The object type that should be returned.
+      *
+      * @returns All objects that matches the specified object type.
+      */
+     std::vector<Object*> type_objects(const std::string& type) const;
+
+     /**
+      * @brief Get all variants ordered by their dense index.
+      *
+      * @return The variants, an entry is null if the variant was deleted.
+      */
+     const std::vector<Variant*>& variants() const { return variants_; }
+
+     /**
+      * @brief Registers a variant and assigns its dense index, called by the
+      * Variant constructor. Indices are not reused until the simulation is cleared.
+      *
+      * @param variant The variant.
+      *
+      * @return The index of the variant.
+      */
+     uint32_t register_variant(Variant *variant);
+
+     /**
+      * @brief Unregisters a variant, called by the Variant destructor.
+      *
+      * @param variant The variant.
+      */
+     void unregister_variant(Variant *variant);
+
+     /**
+      * @brief Searches for an object with a specified id.
+      *
+      * @tparam T The class to object should be cast to.
+      * @param  id                The identifier.
+      * @param  recursive         True to search recursively, false to search the root component only.
+      * @param  include_templates True to include templates in the search, false to exclude them.
+      *
+      * @returns The object cast to the specified type, or nullptr if the object is not found or it is
+      *          of the wrong type.
+      */
+     template <typename T = Object>
+     T* find_object_by_id(const std::string & id,
+                          bool recursive = true,
+                          bool include_templates = false) const
+     {
+         T* object = root_component_->find_object_by_id<T>(id, recursive);
+
+         if (!object && include_templates) {
+             for (Component* component : templates()) {
+                 object = component->find_object_by_id<T>(id, recursive);
+                 if (object)
+                     break;
+             }
+         }
+
+         return object;
+     }
+
+     /**
+      * @brief Searches for an object with a specified interned id.
+      *
+      * @tparam T The class to object should be cast to.
+      * @param  id                The interned identifier.
+      * @param  recursive         True to search recursively, false to search the root component only.
+      * @param  include_templates True to include templates in the search, false to exclude them.
+      *
+      * @returns The object cast to the specified type, or nullptr if the object is not found or it is
+      *          of the wrong type.
+      */
+     template <typename T = Object>
+     T* find_object_by_id(Symbol id,
+                          bool recursive = true,
+                          bool include_templates = false) const
+     {
+         T* object = root_component_->find_object_by_id<T>(id, recursive);
+
+         if (!object && include_templates) {
+             for (Component* component : templates()) {
+                 object = component->find_object_by_id<T>(id, recursive);
+                 if (object)
+                     break;
+             }
+         }
+
+         return object;
+     }
+
+     /**
+      * @brief Searches for an object with a specified name.
+      *
+      * @tparam T The class to object should be cast to.
+      * @param  name              The name.
+      * @param  recursive         True to search recursively, false to search the root component only.
+      * @param  include_templates True to include templates in the search, false to exclude them.
+      *
+      * @returns The object cast to the specified type, or nullptr if the object is not found or it is
+      *          of the wrong type.
+      */
+     template <typename T = Object>
+     T* find_object_by_name(const std::string& name,
+                          bool recursive = true,
+                          bool include_templates = false) const
+     {
+         T* object = root_component_->find_object_by_name<T>(name, recursive);
+
+         if (!object && include_templates) {
+             for (Component* component : templates()) {
+                 object = component->find_object_by_name<T>(name, recursive);
+                 if (object)
+                     break;
+             }
+         }
+
+         return object;
+     }
+
+     /**
+      * @brief Returns the location (node) where each entity currently is.
+      *
+      * @return All entities and their respective locations.
+      */
+     std::vector<EntityLocation> entity_locations() const;
+
+     /**
+      * @brief Get the average cycle time of all variants.
+      *
+      * @return The cycle time.
+      */
+     simtime cycle_time() const;
+
+     /**
+      * @brief Get the average work in process of all nodes.
+      *
+      * @return The average work in process.
+      */
+     double wip() const;
+
+     /**
+      * @brief Get the throughput of the model.
+      *
+      * @return The throughput.
+      */
+     double throughput() const;
+
+     /**
+      * @brief Get the total number of entities that have exited the
+      * model.
+      *
+      * @return Total exits.
+      */
+     unsigned int total_exits() const;
+
+     /**
+      * @brief Get all throughput values from each replication.
+      *
+      * @return Throughput replications.
+      */
+     std::vector<double> throughput_replications() const;
+
+     /**
+      * @brief Get all work in process values from each replication.
+      *
+      * @return Work in process replications.
+      */
+     std::vector<double> wip_replications() const;
+
+     /**
+      * @brief Get all cycle time values from each replication.
+      *
+      * @return Cycle time replications.
+      */
+     std::vector<double> cycle_time_replications() const;
+
+     /**
+      * @brief Get all total exits from each replication.
+      *
+      * @return Total exits replications.
+      */
+     std::vector<double> total_exits_replications() const;
+
+     /**
+      * @brief Facilitates communication between the simulation and external receivers.
+      *
+      * Write data to the ostream with the '<<' operator and end by writing 'std::endl'. The
+      * 'std::endl' will flush the ostream and trigger the log_changed signal that external
+      * receivers can subscribe to.
+      *
+      * @return The log output stream.
+      */
+     std::ostream& log() const;
+
+     /**
+      * @brief Add a simulation output.
+      *
+      * Each @p name should have one @p value for each simulation replication.
+      *
+      * @param name The name of the output.
+      * @param value The value of the output.
+      */
+     void add_output(const std::string &name, double value);
+
+     /**
+      * @return All simulation output names and their respective values.
+      */
+     const std::map<std::string, std::vector<double>>& get_output_replications() const;
+
+     XSimLLVM* jit() const;
+
+	 void save_module_file(const std::string &module_name, const std::string &code);
+     void save_internal_file(const std::string &module_name, const std::string &code);
+     void parse_modules(const std::string &code);
+	 void submit_code(std::string text, std::string name);
+
+     /**
+      * @brief Sets the directory of the compiled module cache.
+      *
+      * When set, 'submit_code' and 'parse_modules' look up the compiled object of each module by
+      * a hash of its source, the internal files, the compiler flags, the LLVM version, the JIT
+      * target triple and CPU, the xsim build id and the xsim headers the modules are compiled
+      * against, and skip compilation on a hit. The directory can be shared by many simulation processes.
+      *
+      * @param directory The cache directory, an empty string disables the cache.
+      */
+     void set_module_cache_directory(const std::string &directory);
+
+     /**
+      * @returns The compiled module cache.
+      */
+     ModuleCache& module_cache() { return module_cache_; }
+     const std::vector<std::string>& get_modules() const;
+     const std::vector<std::string>& get_internal_files() const;
+
+     /**
+      * @brief Gets the start time of the simulation
+      *
+      * @returns The start time of the simulation.
+      */
+     std::chrono::system_clock::time_point start_time_point() const;
+
+     /**
+      * @brief Gets the the small size allocator
+      *
+      * @returns A reference to a PoolAllocator.
+      */
+     PoolAllocator<128>& allocator() { return allocator_; }
+
+     /**
+      * @brief Gets the string table that interns object and event identities
+      *
+      * The table is cleared together with the model in @ref clear.
+      *
+      * @returns A reference to the StringTable.
+      */
+     StringTable& strings() { return strings_; }
+
+     /**
+      * @brief Gets the side table that holds the cold data of the entities
+      *
+      * @returns A reference to the EntitySideTable.
+      */
+     EntitySideTable& entity_side_table() { return entity_side_table_; }
+
+     /**
+      * @brief Reports the memory used by the entities currently in the model.
+      *
+      * @returns The number of entities, the size of their hot and cold data and the average bytes
+      *          per entity.
+      */
+     EntityMemoryReport entity_memory_report() const;
+
+     /**
+      * @brief Gets the index of the forward blocked entities by destination and blocking condition.
+      *
+      * The wake-up counters are reset together with the statistics.
+      *
+      * @returns A reference to the WakeupIndex.
+      */
+     WakeupIndex& wakeup_index() { return wakeup_index_; }
+
+     /**
+      * @brief Gets the epoch counter and recycled worklists of the disruption walks.
+      *
+      * @returns A reference to the DisruptionWalkPool.
+      */
+     DisruptionWalkPool& disruption_walks() { return disruption_walks_; }
+
+ private:
+     /** @brief Private default constructor */
+     Simulation() = delete;
+
+     Simulation(const std::string & source_dir, const std::string & lib_dir, const std::string & build_dir);
+    
+
+     /** @brief The Simulation instance */
+     inline static Simulation* instance_ = nullptr;
+
+     /** @brief Creates the root component */
+     void create_root_component();
+
+     /**
+      * @brief A log buffer that stores the intermediate data written the log stream.
+      */
+     LogBuffer *log_buf_;
+
+     /**
+      * @brief The output stream used for logging simulation messages.
+      */
+     std::ostream *log_stream_;
+
+     /**
+      * @brief Starts the simulation.
+      *
+      * @param time The simulation stop time.
+      * @param replications The number of replications to perform.
+      */
+     void simulate(simtime time, int replications = 1);
+
+     /**
+      * @brief Insert an event.
+      *
+      * Time of the event is implicitly decided by the start event, whenever
+      * that event is scheduled to happen that is the time the insert event
+      * will also have. The inserted event can also not be scheduled before
+      * the start event.
+      *
+      * @param start The event after which the new event should be inserted.
+      * @param insert The event that should be inserted.
+      */
+     void insert_event(Event *start, Event *insert);
+
+     /**
+      * @brief Insert an event directly after another event.
+      *
+      * Time of the event is implicitly decided by the first event, whenever
+      * that event is scheduled to happen that is the time the insert event
+      * will also have.
+      *
+      * @param evt The event after which the new event should be inserted.
+      * @param insert The event that should be inserted.
+      */
+     void insert_event_after(Event *evt, Event *insert);
+
+     /**
+      * @brief Free all events from the event list.
+      */
+     void free_events();
+
+     /**
+      * @brief Process the event list until there are no more events or the
+      * simulation stop time is reached.
+      *
+      * @param time The simulation stop time.
+      */
+     void simulate_events(simtime time);
+
+     /**
+      * @brief Check if event matches any breakpoints.
+      *
+      * @param evt The event to set breakpoint on.
+      */
+     void check_breakpoints(Event *evt);
+
+     /**
+      * @brief Saves a event to a file.
+      *
+      * @param evt The event to save.
+      */
+     void trace(Event *evt, std::ofstream &trace_file);
+
+     /**
+      * @brief A global counter to keep all batch ids unique.
+      */
+     unsigned int batch_id_;
+
+     /**
+      * @brief Store different statistics for each replication.
+      */
+     std::vector<double> total_exits_replications_;
+     std::vector<double> throughput_replications_;
+     std::vector<simtime> cycle_time_replications_;
+     std::vector<double> wip_replications_;
+     std::map<std::string, std::vector<double>> output_replications_;
+
+     /**
+      * @brief The simulation horizon that is read from the xml file.
+      */
+     simtime horizon_;
+
+     /**
+      * @brief The simulation warmup that is read from the xml file.
+      */
+     simtime warmup_;
+
+     /**
+      * @brief The number of replications that is read from the xml file.
+      */
+     unsigned int replications_;
+
+     /**
+      * @brief The current replication index.
+      */
+     unsigned int replication_;
+
+     /**
+      * @brief The random generator used to generate all random numbers. This
+      * is the only allowed generator, no other generator should be used
+      * throughout the entire simulation.
+      */
+     RandomGenerator *rng_;
+
+     /** @brief The seed of the variate streams, see variate_seed(). */
+     uint64_t variate_seed_;
+
+     /** @brief The number of variate streams allocated to generators without an id. */
+     uint64_t variate_streams_;
+
+     /** @brief The number of variate streams allocated per id hash, see allocate_variate_stream(). */
+     std::unordered_map<uint64_t, uint64_t> variate_stream_copies_;
+
+     /** @brief All variants indexed by Variant::index(). */
+     std::vector<Variant*> variants_;
+
+     /**
+      * @brief Set to true to cancel the simulation.
+      */
+     bool simulation_canceled_;
+
+     /**
+      * @brief The current simulation time.
+      */
+     simtime simclock_;
+
+     /**
+      * @brief Set to true if shifting bottleneck detection should be used.
+      */
+     bool shifting_bottleneck_detection_;
+
+     /**
+      * @brief All active periods stored be per node.
+      */
+     std::map<Node*, std::vector<ActivePeriod*>> active_periods_;
+
+     /**
+      * @brief The event queue.
+      */
+     //EventQueue events_;
+     std::map<double, Event*> events_;
+
+     /**
+      * @brief The number of events in the event list.
+      */
+     size_t event_count_;
+
+     /** @brief True if the simulation runs headless, see headless(). */
+     bool headless_;
+
+     /** @brief True if nodes use virtual clocks, see virtual_node_clocks(). */
+     bool virtual_node_clocks_;
+
+     /** @brief The number of visual events skipped in headless mode. */
+     uint64_t skipped_visual_events_;
+
+     /** @brief The frame publisher, see start_frame_publisher(). */
+     FramePublisher *frame_publisher_;
+
+     /** @brief The nodes in the order of the frame name table. */
+     std::vector<Node*> frame_nodes_;
+
+     Event *current_event_;
+
+     /**
+      * @brief The root component that contains all objects.
+      */
+     Component *root_component_;
+
+     /**
+      * @brief All managed nodes.
+      */
+     std::vector<std::string> skill_ids_;
+     std::vector<Component*> templates_;
+     std::vector<Variable*> variables_;
+
+     /**
+      * @brief The variables indexed by id.
+      */
+     std::unordered_map<std::string, Variable*> variable_index_;
+
+     /**
+      * @brief Compiles and re-evaluates the expressions of all Double and Int parameters.
+      */
+     ExpressionCompiler expressions_;
+
+     /**
+      * @brief All breakpoints.
+      */
+     std::list<Breakpoint*> breakpoints_;
+
+     /**
+      * @brief True if breakpoints are active.
+      */
+     bool breakpoints_active_;
+
+     /**
+      * @brief The event to stop on. Works only for single stepping.
+      */
+     Event *stop_event_;
+
+     /** @brief The start time point of the simulation */
+     std::chrono::system_clock::time_point start_time_point_;
+
+     /** @brief A custom pool allocator */
+     PoolAllocator<128> allocator_;
+
+     /** @brief Interned types, names, ids and paths of all objects */
+     StringTable strings_;
+
+     /** @brief Cold data of the entities, allocated on first use */
+     EntitySideTable entity_side_table_;
+
+     /** @brief The number of entities that currently exist */
+     size_t entity_count_;
+
+     /** @brief Forward blocked entities by destination and blocking condition */
+     WakeupIndex wakeup_index_;
+
+     /** @brief Epochs and worklists of the disruption walks */
+     DisruptionWalkPool disruption_walks_;
+
+     XSimLLVM *jit_;
+
+     /** @brief Cache of compiled user modules */
+     ModuleCache module_cache_;
+
+	 std::string source_dir_;
+	 std::string build_dir_;
+	 std::string lib_dir_;
+     std::vector<std::string> modules_;
+     std::vector<std::string> internal_files_;
+     //std::vector<std::pair<std::string, std::string>> modules_;
+
+     /**
+      * @brief The user data that was sent into the simulation.
+      */
+     std::string user_data_input_;
+
+     /**
+      * @brief The user data, one for each replication, that is produced in the simulation.
+      */
+     std::vector<std::string> user_data_output_;
+};
+
+constexpr auto sim = &Simulation::instance;
+
+} // namespace xsim
+
+#endif // SIMULATION_H
@@ -0,0 +1,471 @@
+#ifndef SKILLMATCHER_H
+#define SKILLMATCHER_H
+
+#include <xsim_config>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "noderesource.h"
+
+namespace xsim {
+
+class LogicResource;
+
+/**
+ * @brief A set of skills, one bit per skill id of Simulation::get_skill_id.
+ */
+class SkillSet {
+public:
+    SkillSet() = default;
+
+    /**
+     * @param skill The skill id.
+     */
+    void insert(int skill)
+    {
+        size_t word = static_cast<size_t>(skill) / 64;
+        if (word >= words_.size())
+            words_.resize(word + 1, 0);
+        words_[word] |= uint64_t(1) << (skill % 64);
+    }
+
+    /**
+     * @param skill The skill id.
+     *
+     * @returns True if the set has the skill.
+     */
+    bool contains(int skill) const
+    {
+        size_t word = static_cast<size_t>(skill) / 64;
+        return word < words_.size() && (words_[word] >> (skill % 64)) & 1;
+    }
+
+    /**
+     * @returns True if this set has all skills of @p other.
+     */
+    bool contains_all(const SkillSet& other) const
+    {
+        for (size_t i = 0; i < other.words_.size(); ++i)
+            if ((other.words_[i] & word(i)) != other.words_[i])
+                return false;
+        return true;
+    }
+
+    /**
+     * @returns True if this set has any skill of @p other.
+     */
+    bool intersects(const SkillSet& other) const
+    {
+        size_t size = std::min(words_.size(), other.words_.size());
+        for (size_t i = 0; i < size; ++i)
+            if (words_[i] & other.words_[i])
+                return true;
+        return false;
+    }
+
+    /**
+     * @brief Adds all skills of @p other.
+     */
+    SkillSet& operator|=(const SkillSet& other)
+    {
+        if (other.words_.size() > words_.size())
+            words_.resize(other.words_.size(), 0);
+        for (size_t i = 0; i < other.words_.size(); ++i)
+            words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    /**
+     * @returns The number of skills.
+     */
+    size_t count() const
+    {
+        size_t count = 0;
+        for (uint64_t word : words_)
+            for (; word; word &= word - 1)
+                ++count;
+        return count;
+    }
+
+    bool empty() const { return count() == 0; }
+
+    void clear() { words_.clear(); }
+
+    bool operator<(const SkillSet& other) const
+    {
+        size_t size = std::max(words_.size(), other.words_.size());
+        for (size_t i = size; i-- > 0;)
+            if (word(i) != other.word(i))
+                return word(i) < other.word(i);
+        return false;
+    }
+
+    bool operator==(const SkillSet& other) const
+    {
+        return !(*this < other) && !(other < *this);
+    }
+
+private:
+    uint64_t word(size_t i) const { return i < words_.size() ? words_[i] : 0; }
+
+    std::vector<uint64_t> words_;
+};
+
+/**
+ * @brief Finds idle logic resources for skills without searching.
+ *
+ * The resources are ranked once per NodeResource::Sorting policy, from the
+ * number of skills and the execution factor, when the model is prepared. For
+ * every policy and skill a bitset over the ranked resources marks those that
+ * have the skill, and another bitset marks the idle resources. The best idle
+ * resource for a skill is then the lowest bit of an AND of the two, which is
+ * a scan over a few words instead of a sort of the candidates.
+ */
+class SkillMatcher {
+public:
+    /** @brief The number of sorting policies. */
+    static constexpr size_t POLICIES = NodeResource::SLOW_EXECUTION_MANY_SKILLS + 1;
+
+    /** @brief Returned when no resource is found. */
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    SkillMatcher() = default;
+
+    /**
+     * @brief Adds a resource, must be called before build.
+     *
+     * @param resource         The resource.
+     * @param skills           The skills of the resource.
+     * @param execution_factor The execution factor of the resource.
+     *
+     * @returns The index of the resource.
+     */
+    size_t add(LogicResource *resource, const SkillSet& skills, double execution_factor)
+    {
+        resources_.push_back(Entry{ resource, skills, skills.count(), execution_factor });
+        return resources_.size() - 1;
+    }
+
+    /**
+     * @brief Ranks the resources and builds the bitsets, all resources start idle.
+     *
+     * @param skill_count The number of skill ids.
+     */
+    void build(size_t skill_count)
+    {
+        size_t words = (resources_.size() + 63) / 64;
+        skill_count_ = skill_count;
+        for (size_t policy = 0; policy < POLICIES; ++policy) {
+            Pool& pool = pools_[policy];
+            pool.ranked.resize(resources_.size());
+            for (size_t i = 0; i < resources_.size(); ++i)
+                pool.ranked[i] = i;
+            std::stable_sort(pool.ranked.begin(), pool.ranked.end(), [&](size_t a, size_t b) {
+                return rank_key(static_cast<NodeResource::Sorting>(policy), resources_[a]) <
+                    rank_key(static_cast<NodeResource::Sorting>(policy), resources_[b]);
+            });
+            pool.rank.resize(resources_.size());
+            pool.skills.assign(skill_count * words, 0);
+            pool.idle.assign(words, 0);
+            for (size_t rank = 0; rank < pool.ranked.size(); ++rank) {
+                size_t index = pool.ranked[rank];
+                pool.rank[index] = rank;
+                for (size_t skill = 0; skill < skill_count; ++skill)
+                    if (resources_[index].skills.contains(static_cast<int>(skill)))
+                        pool.skills[skill * words + rank / 64] |= uint64_t(1) << (rank % 64);
+                pool.idle[rank / 64] |= uint64_t(1) << (rank % 64);
+            }
+        }
+        idle_count_ = resources_.size();
+    }
+
+    /**
+     * @brief Finds the best idle resource with a skill.
+     *
+     * @param skill   The skill id.
+     * @param sorting The sorting policy.
+     *
+     * @returns The index of the resource, or NONE.
+     */
+    size_t find(int skill, NodeResource::Sorting sorting) const
+    {
+        if (skill < 0 || static_cast<size_t>(skill) >= skill_count_)
+            return NONE;
+        const Pool& pool = pools_[sorting];
+        size_t words = pool.idle.size();
+        const uint64_t *skills = pool.skills.data() + skill * words;
+        for (size_t i = 0; i < words; ++i) {
+            uint64_t candidates = skills[i] & pool.idle[i];
+            if (candidates)
+                return pool.ranked[i * 64 + lowest_bit(candidates)];
+        }
+        return NONE;
+    }
+
+    /**
+     * @brief Marks a resource as allocated or idle in all pools.
+     *
+     * @param index The index of the resource.
+     * @param idle  True if the resource is idle.
+     */
+    void set_idle(size_t index, bool idle)
+    {
+        for (Pool& pool : pools_) {
+            size_t rank = pool.rank[index];
+            uint64_t bit = uint64_t(1) << (rank % 64);
+            bool was_idle = (pool.idle[rank / 64] & bit) != 0;
+            if (was_idle == idle)
+                return;
+            if (idle)
+                pool.idle[rank / 64] |= bit;
+            else
+                pool.idle[rank / 64] &= ~bit;
+        }
+        idle ? ++idle_count_ : --idle_count_;
+    }
+
+    /**
+     * @returns The skills of all idle resources combined.
+     */
+    SkillSet idle_skills() const
+    {
+        SkillSet skills;
+        const Pool& pool = pools_[0];
+        for (size_t rank = 0; rank < pool.ranked.size(); ++rank)
+            if ((pool.idle[rank / 64] >> (rank % 64)) & 1)
+                skills |= resources_[pool.ranked[rank]].skills;
+        return skills;
+    }
+
+    /**
+     * @param index The index of a resource.
+     *
+     * @returns The resource.
+     */
+    LogicResource* resource(size_t index) const { return resources_[index].resource; }
+
+    /**
+     * @param index The index of a resource.
+     *
+     * @returns The skills of the resource.
+     */
+    const SkillSet& skills(size_t index) const { return resources_[index].skills; }
+
+    /**
+     * @returns The number of resources.
+     */
+    size_t size() const { return resources_.size(); }
+
+    /**
+     * @returns The number of idle resources.
+     */
+    size_t idle_count() const { return idle_count_; }
+
+    /**
+     * @brief Removes all resources.
+     */
+    void clear()
+    {
+        resources_.clear();
+        for (Pool& pool : pools_)
+            pool = Pool();
+        skill_count_ = 0;
+        idle_count_ = 0;
+    }
+
+private:
+    struct Entry {
+        LogicResource *resource;
+        SkillSet skills;
+        size_t skill_count;
+        double execution_factor;
+    };
+
+    struct Pool {
+        /** @brief Resource indices in rank order. */
+        std::vector<size_t> ranked;
+        /** @brief The rank of each resource index. */
+        std::vector<size_t> rank;
+        /** @brief One bitset over the ranks per skill. */
+        std::vector<uint64_t> skills;
+        /** @brief The idle resources as a bitset over the ranks. */
+        std::vector<uint64_t> idle;
+    };
+
+    static std::pair<double, double> rank_key(NodeResource::Sorting sorting, const Entry& entry)
+    {
+        double skills = static_cast<double>(entry.skill_count);
+        double factor = entry.execution_factor;
+        switch (sorting) {
+        case NodeResource::FEW_SKILLS_FAST_EXECUTION: return { skills, factor };
+        case NodeResource::FEW_SKILLS_SLOW_EXECUTION: return { skills, -factor };
+        case NodeResource::MANY_SKILLS_FAST_EXECUTION: return { -skills, factor };
+        case NodeResource::MANY_SKILLS_SLOW_EXECUTION: return { -skills, -factor };
+        case NodeResource::FAST_EXECUTION_FEW_SKILLS: return { factor, skills };
+        case NodeResource::FAST_EXECUTION_MANY_SKILLS: return { factor, -skills };
+        case NodeResource::SLOW_EXECUTION_FEW_SKILLS: return { -factor, skills };
+        case NodeResource::SLOW_EXECUTION_MANY_SKILLS: return { -factor, -skills };
+        }
+        return { 0.0, 0.0 };
+    }
+
+    static size_t lowest_bit(uint64_t word)
+    {
+        size_t bit = 0;
+        while (!(word & 1)) {
+            word >>= 1;
+            ++bit;
+        }
+        return bit;
+    }
+
+    std::vector<Entry> resources_;
+    Pool pools_[POLICIES];
+    size_t skill_count_ = 0;
+    size_t idle_count_ = 0;
+};
+
+/**
+ * @brief Blocked resource requests grouped by the skills they still miss.
+ *
+ * A request is grouped by its outstanding skills, the required skills that
+ * are not yet covered by the resources it holds, and is moved to another
+ * group with rekey() when that changes. When a resource is released only the
+ * groups that miss one of its skills, and whose missing skills are all held
+ * by some idle resource, are retried. Requests that miss no skill, and wait
+ * for something else such as the number of resources, are always retried.
+ * Within the retried groups the requests keep the order they were blocked in.
+ *
+ * @tparam T The request type.
+ */
+template <typename T>
+class SkillBlockList {
+public:
+    /**
+     * @brief Adds a blocked request.
+     *
+     * @param outstanding The skills the request still misses.
+     * @param request     The request.
+     */
+    void add(const SkillSet& outstanding, T *request)
+    {
+        groups_[outstanding].push_back(Item{ sequence_++, request });
+        ++size_;
+    }
+
+    /**
+     * @brief Removes a blocked request.
+     *
+     * @param outstanding The skills the request missed when it was added or last rekeyed.
+     * @param request     The request.
+     *
+     * @returns True if the request was blocked.
+     */
+    bool remove(const SkillSet& outstanding, T *request)
+    {
+        return take(outstanding, request) != nullptr;
+    }
+
+    /**
+     * @brief Moves a blocked request to the group of the skills it misses
+     * now, called when it acquired some of them. It keeps its place in the
+     * block order.
+     *
+     * @param from    The skills the request missed before.
+     * @param to      The skills the request misses now.
+     * @param request The request.
+     *
+     * @returns True if the request was blocked.
+     */
+    bool rekey(const SkillSet& from, const SkillSet& to, T *request)
+    {
+        if (from == to)
+            return true;
+        uint64_t sequence;
+        if (!take(from, request, &sequence))
+            return false;
+        auto& items = groups_[to];
+        Item item{ sequence, request };
+        items.insert(std::upper_bound(items.begin(), items.end(), item,
+                                      [](const Item& a, const Item& b) { return a.sequence < b.sequence; }),
+                     item);
+        ++size_;
+        return true;
+    }
+
+    /**
+     * @brief Collects the requests worth retrying after a release.
+     *
+     * @param released  The skills of the released resource.
+     * @param available The skills of all idle resources.
+     * @param requests  Receives the requests in the order they were blocked.
+     */
+    void collect(const SkillSet& released, const SkillSet& available, std::vector<T*>& requests) const
+    {
+        std::vector<Item> items;
+        for (const auto& [outstanding, group] : groups_)
+            if (outstanding.empty() || (outstanding.intersects(released) && available.contains_all(outstanding)))
+                items.insert(items.end(), group.begin(), group.end());
+        std::sort(items.begin(), items.end(),
+                  [](const Item& a, const Item& b) { return a.sequence < b.sequence; });
+        requests.clear();
+        for (const Item& item : items)
+            requests.push_back(item.request);
+    }
+
+    /**
+     * @returns The number of blocked requests.
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Removes all requests.
+     */
+    void clear()
+    {
+        groups_.clear();
+        size_ = 0;
+    }
+
+private:
+    struct Item {
+        uint64_t sequence;
+        T *request;
+    };
+
+    /**
+     * @brief Removes a request from a group.
+     *
+     * @returns The request, or nullptr if it was not in the group.
+     */
+    T* take(const SkillSet& outstanding, T *request, uint64_t *sequence = nullptr)
+    {
+        auto group = groups_.find(outstanding);
+        if (group == groups_.end())
+            return nullptr;
+        auto& items = group->second;
+        auto it = std::find_if(items.begin(), items.end(),
+                               [request](const Item& item) { return item.request == request; });
+        if (it == items.end())
+            return nullptr;
+        if (sequence)
+            *sequence = it->sequence;
+        items.erase(it);
+        if (items.empty())
+            groups_.erase(group);
+        --size_;
+        return request;
+    }
+
+    std::map<SkillSet, std::vector<Item>> groups_;
+    uint64_t sequence_ = 0;
+    size_t size_ = 0;
+};
+
+} // namespace xsim
+
+#endif // SKILLMATCHER_H
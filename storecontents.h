@@ -0,0 +1,275 @@
+#ifndef STORECONTENTS_H
+#define STORECONTENTS_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "entitytime.h"
+#include "intrusivelist.h"
+#include "variantmap.h"
+
+namespace xsim {
+
+/**
+ * @brief Tags of the intrusive chains that link the records of a
+ * StoreContents in arrival order, per variant and per batch.
+ */
+struct StoreArrivalLink {};
+struct StoreVariantLink {};
+struct StoreBatchLink {};
+
+/**
+ * @brief An entity in a store, linked into the arrival chain and the chains
+ * of its variant and batch.
+ */
+struct StoreRecord : public IntrusiveListHook<StoreArrivalLink>,
+                     public IntrusiveListHook<StoreVariantLink>,
+                     public IntrusiveListHook<StoreBatchLink> {
+    /** @brief The entity and the simulation time it is ready to leave. */
+    EntityTime item;
+    Variant *variant = nullptr;
+    /** @brief The batch id of the entity, zero if it is not in a batch. */
+    unsigned int batch = 0;
+};
+
+/**
+ * @brief The contents of a Store, indexed by arrival order, variant and batch.
+ *
+ * The records are allocated from a slab and reused, and each record is
+ * linked into FIFO chains for arrival order, its variant and its batch. The
+ * first entity of a variant or batch, the count per variant or batch and
+ * removing an entity are O(1), and the contents can be iterated in any of
+ * the orders without copying.
+ */
+class StoreContents {
+public:
+    typedef IntrusiveList<StoreRecord, StoreArrivalLink> ArrivalChain;
+    typedef IntrusiveList<StoreRecord, StoreVariantLink> VariantChain;
+    typedef IntrusiveList<StoreRecord, StoreBatchLink> BatchChain;
+
+    StoreContents() = default;
+
+    /** Copying and moving the contents is not supported. */
+    StoreContents(const StoreContents&) = delete;
+    StoreContents& operator=(const StoreContents&) = delete;
+
+    ~StoreContents()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Adds an entity last in all its chains.
+     *
+     * @param entity  The entity.
+     * @param variant The variant of the entity.
+     * @param batch   The batch id of the entity, zero if none.
+     * @param time    The simulation time the entity is ready to leave.
+     *
+     * @returns The record of the entity.
+     */
+    StoreRecord* insert(Entity *entity, Variant *variant, unsigned int batch, simtime time)
+    {
+        StoreRecord *record = allocate();
+        record->item = EntityTime(entity, time);
+        record->variant = variant;
+        record->batch = batch;
+        arrivals_.push_back(record);
+        variant_chain(variant).push_back(record);
+        if (batch != 0)
+            batch_chain(batch).push_back(record);
+        records_[entity] = record;
+        return record;
+    }
+
+    /**
+     * @brief Removes an entity.
+     *
+     * @param entity The entity.
+     *
+     * @returns True if the entity was in the store.
+     */
+    bool erase(Entity *entity)
+    {
+        auto it = records_.find(entity);
+        if (it == records_.end())
+            return false;
+        StoreRecord *record = it->second;
+        records_.erase(it);
+        arrivals_.remove(record);
+        variant_chain(record->variant).remove(record);
+        if (record->batch != 0) {
+            auto batch = batches_.find(record->batch);
+            BatchChain& chain = batch_chains_[batch->second];
+            chain.remove(record);
+            if (chain.empty()) {
+                free_batch_chains_.push_back(batch->second);
+                batches_.erase(batch);
+            }
+        }
+        free_.push_back(record);
+        return true;
+    }
+
+    /**
+     * @param entity The entity.
+     *
+     * @returns The record of the entity, or nullptr if it is not in the store.
+     */
+    StoreRecord* find(Entity *entity) const
+    {
+        auto it = records_.find(entity);
+        return it != records_.end() ? it->second : nullptr;
+    }
+
+    /**
+     * @returns The entity that arrived first, or nullptr if the store is empty.
+     */
+    StoreRecord* front() const { return arrivals_.front(); }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The entity of the variant that arrived first, or nullptr.
+     */
+    StoreRecord* front(Variant *variant) const
+    {
+        const size_t *chain = variants_.find(variant);
+        return chain ? variant_chains_[*chain].front() : nullptr;
+    }
+
+    /**
+     * @param batch The batch id.
+     *
+     * @returns The entity of the batch that arrived first, or nullptr.
+     */
+    StoreRecord* front_of_batch(unsigned int batch) const
+    {
+        auto it = batches_.find(batch);
+        return it != batches_.end() ? batch_chains_[it->second].front() : nullptr;
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The number of entities of the variant.
+     */
+    size_t count(Variant *variant) const
+    {
+        const size_t *chain = variants_.find(variant);
+        return chain ? variant_chains_[*chain].size() : 0;
+    }
+
+    /**
+     * @param batch The batch id.
+     *
+     * @returns The number of entities of the batch.
+     */
+    size_t count_of_batch(unsigned int batch) const
+    {
+        auto it = batches_.find(batch);
+        return it != batches_.end() ? batch_chains_[it->second].size() : 0;
+    }
+
+    /**
+     * @returns All entities in arrival order.
+     */
+    const ArrivalChain& arrivals() const { return arrivals_; }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The entities of the variant in arrival order.
+     */
+    const VariantChain& of_variant(Variant *variant) const
+    {
+        static const VariantChain empty;
+        const size_t *chain = variants_.find(variant);
+        return chain ? variant_chains_[*chain] : empty;
+    }
+
+    /**
+     * @returns The number of entities.
+     */
+    size_t size() const { return records_.size(); }
+
+    /**
+     * @returns True if the store is empty.
+     */
+    bool empty() const { return records_.empty(); }
+
+    /**
+     * @brief Removes all entities, the slab is kept for reuse.
+     */
+    void clear()
+    {
+        arrivals_.clear();
+        for (VariantChain& chain : variant_chains_)
+            chain.clear();
+        for (BatchChain& chain : batch_chains_)
+            chain.clear();
+        free_batch_chains_.clear();
+        for (size_t i = 0; i < batch_chains_.size(); ++i)
+            free_batch_chains_.push_back(i);
+        batches_.clear();
+        records_.clear();
+        free_.clear();
+        for (StoreRecord& record : slab_)
+            free_.push_back(&record);
+    }
+
+private:
+    StoreRecord* allocate()
+    {
+        if (!free_.empty()) {
+            StoreRecord *record = free_.back();
+            free_.pop_back();
+            return record;
+        }
+        slab_.emplace_back();
+        return &slab_.back();
+    }
+
+    VariantChain& variant_chain(Variant *variant)
+    {
+        if (!variants_.contains(variant)) {
+            variants_[variant] = variant_chains_.size();
+            variant_chains_.emplace_back();
+        }
+        return variant_chains_[variants_[variant]];
+    }
+
+    BatchChain& batch_chain(unsigned int batch)
+    {
+        auto it = batches_.find(batch);
+        if (it != batches_.end())
+            return batch_chains_[it->second];
+        size_t chain;
+        if (!free_batch_chains_.empty()) {
+            chain = free_batch_chains_.back();
+            free_batch_chains_.pop_back();
+        } else {
+            chain = batch_chains_.size();
+            batch_chains_.emplace_back();
+        }
+        batches_.emplace(batch, chain);
+        return batch_chains_[chain];
+    }
+
+    ArrivalChain arrivals_;
+    std::deque<VariantChain> variant_chains_;
+    VariantMap<size_t> variants_;
+    std::deque<BatchChain> batch_chains_;
+    std::vector<size_t> free_batch_chains_;
+    std::unordered_map<unsigned int, size_t> batches_;
+    std::unordered_map<Entity*, StoreRecord*> records_;
+    std::deque<StoreRecord> slab_;
+    std::vector<StoreRecord*> free_;
+};
+
+} // namespace xsim
+
+#endif // STORECONTENTS_H
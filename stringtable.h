@@ -0,0 +1,130 @@
+#ifndef STRINGTABLE_H
+#define STRINGTABLE_H
+
+#include <xsim_config>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace xsim {
+
+/** @brief A compact identifier of an interned string. */
+typedef uint32_t Symbol;
+
+/** @brief The symbol of the empty string, always present in a string table. */
+const Symbol EMPTY_SYMBOL = 0;
+
+/** @brief Returned by StringTable::find when a string has not been interned. */
+const Symbol INVALID_SYMBOL = std::numeric_limits<Symbol>::max();
+
+/**
+ * @brief Interns strings and hands out compact symbols for them.
+ *
+ * Each distinct string is stored once and is identified by a Symbol. Two
+ * symbols from the same table are equal if and only if the strings are equal,
+ * so comparing symbols is the same as comparing strings. The storage of an
+ * interned string never moves, views returned by @ref view stay valid until
+ * the table is cleared.
+ */
+class StringTable {
+public:
+    StringTable()
+    {
+        clear();
+    }
+
+    /** Copying and moving string tables is not supported. */
+    StringTable(const StringTable&) = delete;
+    StringTable& operator=(const StringTable&) = delete;
+
+    /**
+     * @brief Interns a string.
+     *
+     * @param  str The string to intern.
+     *
+     * @returns The symbol of the string, a new symbol is created if the string
+     *          has not been interned before.
+     */
+    Symbol intern(std::string_view str)
+    {
+        auto it = lookup_.find(str);
+        if (it != lookup_.end())
+            return it->second;
+
+        Symbol symbol = static_cast<Symbol>(strings_.size());
+        const std::string& stored = strings_.emplace_back(str);
+        lookup_.emplace(std::string_view(stored), symbol);
+        return symbol;
+    }
+
+    /**
+     * @brief Searches for a string without interning it.
+     *
+     * @param  str The string to search for.
+     *
+     * @returns The symbol of the string if found, otherwise INVALID_SYMBOL.
+     */
+    Symbol find(std::string_view str) const
+    {
+        auto it = lookup_.find(str);
+        return it != lookup_.end() ? it->second : INVALID_SYMBOL;
+    }
+
+    /**
+     * @param  symbol The symbol to resolve.
+     *
+     * @returns A view of the interned string, or an empty view if the symbol is
+     *          not part of this table.
+     */
+    std::string_view view(Symbol symbol) const
+    {
+        if (symbol >= strings_.size())
+            return std::string_view();
+        return strings_[symbol];
+    }
+
+    /**
+     * @param  symbol The symbol to resolve.
+     *
+     * @returns A copy of the interned string.
+     */
+    std::string str(Symbol symbol) const
+    {
+        return std::string(view(symbol));
+    }
+
+    /**
+     * @returns The number of interned strings, including the empty string.
+     */
+    size_t size() const
+    {
+        return strings_.size();
+    }
+
+    /**
+     * @brief Removes all interned strings except the empty string.
+     *
+     * All symbols handed out before the call are invalidated.
+     */
+    void clear()
+    {
+        lookup_.clear();
+        strings_.clear();
+        strings_.emplace_back();
+        lookup_.emplace(std::string_view(strings_.front()), EMPTY_SYMBOL);
+    }
+
+private:
+    /** @brief The interned strings indexed by symbol. */
+    std::deque<std::string> strings_;
+
+    /** @brief Maps the interned strings to their symbols. */
+    std::unordered_map<std::string_view, Symbol> lookup_;
+};
+
+} // namespace xsim
+
+#endif // STRINGTABLE_H
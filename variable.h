@@ -0,0 +1,58 @@
+#ifndef VARIABLE_H
+#define VARIABLE_H
+
+#include <xsim_config>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+namespace xsim {
+
+/**
+ * @brief A model variable that Double and Int expressions can read.
+ *
+ * The expressions that read the variable cache their value. Writing value_
+ * directly, or through value_ptr(), does not re-evaluate them, so existing
+ * code that does must call ExpressionCompiler::variable_changed afterwards.
+ * Simulation::set_variable writes the value and re-evaluates them in one go.
+ */
+struct Variable {
+    std::string name;
+    std::string id;
+    std::string data_type;
+    double value_ = 0.0;
+
+    /**
+     * @returns A pointer to the value, see the note on writing it above.
+     */
+    double* value_ptr()
+    {
+        return &value_;
+    }
+
+    const double* value_ptr() const
+    {
+        return &value_;
+    }
+
+    int as_int() const
+    {
+        return static_cast<int>(std::round(value_));
+    }
+
+    double as_double() const
+    {
+        return value_;
+    }
+
+    std::string to_string() const
+    {
+        std::stringstream ss;
+        ss << value_;
+        return ss.str();
+    }
+};
+
+} // namespace xsim
+
+#endif // VARIABLE_H
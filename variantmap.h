@@ -0,0 +1,176 @@
+#ifndef VARIANTMAP_H
+#define VARIANTMAP_H
+
+#include <xsim_config>
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+#include "variant.h"
+
+namespace xsim {
+
+/**
+ * @brief Per variant values stored in a flat table indexed by Variant::index().
+ *
+ * A drop-in replacement for std::map<Variant*, T> on the hot paths, a lookup
+ * is an index into a table instead of a tree search. Each slot holds the key
+ * next to the value, an absent variant has a null key. The slots are kept in
+ * a deque that only grows at the end, so as with std::map a reference to a
+ * value stays valid until the value is erased or the map is cleared, also
+ * when other variants are inserted. Iteration visits the present variants in
+ * index order, which is the order the variants were created in.
+ *
+ * @tparam T The value type, must be default constructible.
+ */
+template <typename T>
+class VariantMap {
+public:
+    typedef std::pair<Variant*, T> value_type;
+
+    /**
+     * @brief Forward iterator over the present variants.
+     */
+    template <typename Slot, typename Slots>
+    class basic_iterator {
+    public:
+        basic_iterator(Slots *slots, size_t index) : slots_(slots), index_(index) { skip(); }
+
+        Slot& operator*() const { return (*slots_)[index_]; }
+        Slot* operator->() const { return &(*slots_)[index_]; }
+
+        basic_iterator& operator++()
+        {
+            ++index_;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const basic_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const basic_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        void skip()
+        {
+            while (index_ < slots_->size() && (*slots_)[index_].first == nullptr)
+                ++index_;
+        }
+
+        Slots *slots_;
+        size_t index_;
+    };
+
+    typedef basic_iterator<value_type, std::deque<value_type>> iterator;
+    typedef basic_iterator<const value_type, const std::deque<value_type>> const_iterator;
+
+    VariantMap() : size_(0) {}
+
+    /**
+     * @brief Get the value of a variant, inserting a default value if absent.
+     *
+     * @param variant The variant.
+     *
+     * @returns The value.
+     */
+    T& operator[](Variant *variant)
+    {
+        size_t index = variant->index();
+        if (index >= slots_.size())
+            slots_.resize(index + 1);
+        value_type& slot = slots_[index];
+        if (slot.first == nullptr) {
+            slot.first = variant;
+            ++size_;
+        }
+        return slot.second;
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns The value of the variant, or nullptr if absent.
+     */
+    T* find(const Variant *variant)
+    {
+        size_t index = variant->index();
+        if (index >= slots_.size() || slots_[index].first == nullptr)
+            return nullptr;
+        return &slots_[index].second;
+    }
+
+    const T* find(const Variant *variant) const
+    {
+        return const_cast<VariantMap*>(this)->find(variant);
+    }
+
+    /**
+     * @param variant The variant.
+     *
+     * @returns True if the variant has a value.
+     */
+    bool contains(const Variant *variant) const
+    {
+        return find(variant) != nullptr;
+    }
+
+    /**
+     * @brief Removes the value of a variant.
+     *
+     * @param variant The variant.
+     *
+     * @returns True if the variant had a value.
+     */
+    bool erase(const Variant *variant)
+    {
+        size_t index = variant->index();
+        if (index >= slots_.size() || slots_[index].first == nullptr)
+            return false;
+        slots_[index] = value_type();
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Sizes the table for a number of variants, done at simulation_init
+     *        so no lookup allocates while simulating.
+     *
+     * @param variants The number of variants in the model.
+     */
+    void reserve(size_t variants)
+    {
+        if (variants > slots_.size())
+            slots_.resize(variants);
+    }
+
+    /**
+     * @brief Removes all values.
+     */
+    void clear()
+    {
+        slots_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @returns The number of variants with a value.
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @returns True if no variant has a value.
+     */
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return iterator(&slots_, 0); }
+    iterator end() { return iterator(&slots_, slots_.size()); }
+    const_iterator begin() const { return const_iterator(&slots_, 0); }
+    const_iterator end() const { return const_iterator(&slots_, slots_.size()); }
+
+private:
+    std::deque<value_type> slots_;
+    size_t size_;
+};
+
+} // namespace xsim
+
+#endif // VARIANTMAP_H
@@ -0,0 +1,357 @@
+#ifndef VARIATESTREAM_H
+#define VARIATESTREAM_H
+
+#include <xsim_config>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace xsim {
+
+/**
+ * @brief A random number stream that generates uniform variates in blocks.
+ *
+ * The stream runs four interleaved xoshiro256+ generators, one per 64-bit
+ * lane of an AVX2 register. The scalar fallback produces exactly the same
+ * sequence, so results do not depend on the instruction set of the machine.
+ *
+ * Every stream is seeded from a seed and a stream index, two streams with
+ * different indices are independent. A number generator that owns a stream
+ * therefore draws the same values no matter how many values other number
+ * generators draw in between.
+ */
+class VariateStream {
+public:
+    /** @brief The number of interleaved generators. */
+    static constexpr size_t LANES = 4;
+
+    VariateStream()
+    {
+        seed(0, 0);
+    }
+
+    /**
+     * @brief Seeds the stream.
+     *
+     * @param seed   The simulation seed.
+     * @param stream The stream index.
+     */
+    void seed(uint64_t seed, uint64_t stream)
+    {
+        uint64_t x = seed ^ (stream * 0xd1342543de82ef95ull);
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t lane = 0; lane < LANES; ++lane)
+                state_[i][lane] = split_mix(x);
+    }
+
+    /**
+     * @brief Generates uniform variates in the open interval (0, 1).
+     *
+     * @param values The values to fill.
+     * @param count  The number of values, must be a multiple of LANES.
+     */
+    void fill_uniform(double *values, size_t count)
+    {
+#if defined(__AVX2__)
+        __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state_[0]));
+        __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state_[1]));
+        __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state_[2]));
+        __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state_[3]));
+        const __m256i one = _mm256_set1_epi64x(0x3ff0000000000000ll);
+        const __m256d offset = _mm256_set1_pd(OFFSET);
+        for (size_t i = 0; i < count; i += LANES) {
+            __m256i result = _mm256_add_epi64(s0, s3);
+            __m256i t = _mm256_slli_epi64(s1, 17);
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+            __m256i bits = _mm256_or_si256(_mm256_srli_epi64(result, 12), one);
+            _mm256_storeu_pd(values + i, _mm256_sub_pd(_mm256_castsi256_pd(bits), offset));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state_[0]), s0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state_[1]), s1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state_[2]), s2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state_[3]), s3);
+#else
+        for (size_t i = 0; i < count; i += LANES) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                uint64_t& s0 = state_[0][lane];
+                uint64_t& s1 = state_[1][lane];
+                uint64_t& s2 = state_[2][lane];
+                uint64_t& s3 = state_[3][lane];
+                uint64_t result = s0 + s3;
+                uint64_t t = s1 << 17;
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+                s2 ^= t;
+                s3 = (s3 << 45) | (s3 >> 19);
+                values[i + lane] = to_double(result);
+            }
+        }
+#endif
+    }
+
+private:
+    /**
+     * @brief Subtracted from a double in [1, 2) to get a double in (0, 1),
+     *        the difference is exact.
+     */
+    static constexpr double OFFSET = 1.0 - 1.0 / 9007199254740992.0;
+
+    static uint64_t split_mix(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    static double to_double(uint64_t bits)
+    {
+        union { uint64_t i; double d; } value;
+        value.i = (bits >> 12) | 0x3ff0000000000000ull;
+        return value.d - OFFSET;
+    }
+
+    uint64_t state_[4][LANES];
+};
+
+/**
+ * @brief Kernels that turn a block of uniform variates into a distribution.
+ *
+ * The kernels are plain loops without branches on the sampled values where
+ * possible, so the compiler can vectorize them together with the math library.
+ * Each kernel consumes uniforms from the stream in a fixed order, which keeps
+ * a stream reproducible.
+ */
+namespace variates {
+
+constexpr double TWO_PI = 6.283185307179586476925286766559;
+
+/**
+ * @brief Exponential variates by inverse transform.
+ */
+inline void fill_exponential(VariateStream& stream, double *values, size_t count, double mean)
+{
+    stream.fill_uniform(values, count);
+    for (size_t i = 0; i < count; ++i)
+        values[i] = -mean * std::log(values[i]);
+}
+
+/**
+ * @brief Normal variates by the Box-Muller transform, @p count must be even.
+ */
+inline void fill_normal(VariateStream& stream, double *values, size_t count, double mean, double sigma)
+{
+    stream.fill_uniform(values, count);
+    size_t half = count / 2;
+    for (size_t i = 0; i < half; ++i) {
+        double r = sigma * std::sqrt(-2.0 * std::log(values[i]));
+        double theta = TWO_PI * values[half + i];
+        values[i] = mean + r * std::cos(theta);
+        values[half + i] = mean + r * std::sin(theta);
+    }
+}
+
+/**
+ * @brief Lognormal variates, @p m and @p s are the parameters of the
+ *        underlying normal distribution.
+ */
+inline void fill_lognormal(VariateStream& stream, double *values, size_t count, double m, double s)
+{
+    fill_normal(stream, values, count, m, s);
+    for (size_t i = 0; i < count; ++i)
+        values[i] = std::exp(values[i]);
+}
+
+/**
+ * @brief Weibull variates by inverse transform.
+ */
+inline void fill_weibull(VariateStream& stream, double *values, size_t count, double shape, double scale)
+{
+    stream.fill_uniform(values, count);
+    double inverse_shape = 1.0 / shape;
+    for (size_t i = 0; i < count; ++i)
+        values[i] = scale * std::pow(-std::log(values[i]), inverse_shape);
+}
+
+/**
+ * @brief Triangular variates by inverse transform.
+ */
+inline void fill_triangle(VariateStream& stream, double *values, size_t count,
+                          double lower, double mode, double upper)
+{
+    stream.fill_uniform(values, count);
+    double range = upper - lower;
+    double split = range > 0.0 ? (mode - lower) / range : 0.0;
+    double left = range * (mode - lower);
+    double right = range * (upper - mode);
+    for (size_t i = 0; i < count; ++i) {
+        double u = values[i];
+        values[i] = u < split ? lower + std::sqrt(u * left) : upper - std::sqrt((1.0 - u) * right);
+    }
+}
+
+/**
+ * @brief Gamma variates by the Marsaglia-Tsang method.
+ *
+ * Rejection makes the number of uniforms per variate vary, the uniforms are
+ * still drawn from the stream in blocks.
+ */
+inline void fill_gamma(VariateStream& stream, double *values, size_t count, double shape, double scale)
+{
+    constexpr size_t BLOCK = 64;
+    double uniforms[BLOCK];
+    size_t position = BLOCK;
+    auto uniform = [&]() {
+        if (position == BLOCK) {
+            stream.fill_uniform(uniforms, BLOCK);
+            position = 0;
+        }
+        return uniforms[position++];
+    };
+
+    // Shapes below one are sampled with shape + 1 and scaled by U^(1 / shape).
+    bool boost = shape < 1.0;
+    double d = (boost ? shape + 1.0 : shape) - 1.0 / 3.0;
+    double c = 1.0 / std::sqrt(9.0 * d);
+    for (size_t i = 0; i < count; ++i) {
+        double v;
+        for (;;) {
+            double u1 = uniform();
+            double u2 = uniform();
+            double z = std::sqrt(-2.0 * std::log(u1)) * std::cos(TWO_PI * u2);
+            v = 1.0 + c * z;
+            if (v <= 0.0)
+                continue;
+            v = v * v * v;
+            double u = uniform();
+            if (u < 1.0 - 0.0331 * z * z * z * z || std::log(u) < 0.5 * z * z + d * (1.0 - v + std::log(v)))
+                break;
+        }
+        values[i] = d * v * scale;
+        if (boost)
+            values[i] *= std::pow(uniform(), 1.0 / shape);
+    }
+}
+
+} // namespace variates
+
+/**
+ * @brief A block of buffered variates drawn from a private stream.
+ *
+ * The owner refills the whole block at once with one of the kernels in
+ * xsim::variates, after which each value is returned without any virtual call
+ * into the standard library distributions. The block is discarded when the
+ * seed or the distribution parameters change.
+ */
+class VariateBuffer {
+public:
+    /** @brief The number of buffered values, a multiple of VariateStream::LANES. */
+    static constexpr size_t SIZE = 64;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param stream The stream index, see Simulation::allocate_variate_stream.
+     */
+    explicit VariateBuffer(uint64_t stream = 0) :
+        seed_(0),
+        stream_index_(stream),
+        position_(SIZE),
+        parameters_{ NAN, NAN, NAN }
+    {
+        stream_.seed(seed_, stream_index_);
+    }
+
+    /**
+     * @brief Copies the stream index only, the copy should be given its own
+     *        stream with set_stream.
+     */
+    VariateBuffer(const VariateBuffer& other) : VariateBuffer(other.stream_index_) {}
+    VariateBuffer& operator=(const VariateBuffer&) = delete;
+
+    /**
+     * @brief Moves the buffer to another stream and discards the buffered values.
+     *
+     * @param stream The stream index.
+     */
+    void set_stream(uint64_t stream)
+    {
+        stream_index_ = stream;
+        stream_.seed(seed_, stream_index_);
+        position_ = SIZE;
+    }
+
+    /**
+     * @returns The stream index.
+     */
+    uint64_t stream() const { return stream_index_; }
+
+    /**
+     * @brief Sets the distribution parameters, the buffered values are
+     *        discarded if they were drawn with other parameters.
+     *
+     * @returns True if the parameters changed.
+     */
+    bool set_parameters(double a, double b = 0.0, double c = 0.0)
+    {
+        if (a == parameters_[0] && b == parameters_[1] && c == parameters_[2])
+            return false;
+        parameters_[0] = a;
+        parameters_[1] = b;
+        parameters_[2] = c;
+        position_ = SIZE;
+        return true;
+    }
+
+    /**
+     * @brief Returns the next buffered value, refilling the block first if it
+     *        is used up.
+     *
+     * @param seed The current simulation seed, the stream is reseeded if it changed.
+     * @param fill Called as fill(stream, values, count) to refill the block.
+     *
+     * @returns The next value.
+     */
+    template <typename Fill>
+    double next(uint64_t seed, Fill&& fill)
+    {
+        if (seed != seed_) {
+            seed_ = seed;
+            stream_.seed(seed_, stream_index_);
+            position_ = SIZE;
+        }
+        if (position_ == SIZE) {
+            fill(stream_, values_, SIZE);
+            position_ = 0;
+        }
+        return values_[position_++];
+    }
+
+    /**
+     * @brief Discards the buffered values.
+     */
+    void clear() { position_ = SIZE; }
+
+private:
+    VariateStream stream_;
+    uint64_t seed_;
+    uint64_t stream_index_;
+    size_t position_;
+    double parameters_[3];
+    double values_[SIZE];
+};
+
+} // namespace xsim
+
+#endif // VARIATESTREAM_H
@@ -0,0 +1,215 @@
+#ifndef VIRTUALCLOCK_H
+#define VIRTUALCLOCK_H
+
+#include <xsim_config>
+#include <cstdint>
+#include <vector>
+
+#include "indexedheap.h"
+
+namespace xsim {
+
+class Event;
+
+/**
+ * @brief A node local clock that stops while the node is suspended.
+ *
+ * Events for work in progress on a node, such as out, setup, assemble and
+ * disassemble events, are kept in the clock in local time instead of in the
+ * event list. Only the first of them is represented in the event list, by a
+ * single tick event of the node. Local time is the simulation time minus the
+ * time the clock has been frozen, so when a node fails, pauses or goes
+ * unplanned the clock is frozen and all its events stop together, and when
+ * the node resumes they continue with their remaining time intact. Freezing
+ * and thawing only remove and reinsert the tick, whatever the number of
+ * pending events.
+ *
+ * The clock is bookkeeping only, the node schedules the tick, see
+ * Node::schedule_local.
+ */
+class VirtualClock {
+public:
+    VirtualClock() = default;
+
+    /** Copying and moving the clock is not supported. */
+    VirtualClock(const VirtualClock&) = delete;
+    VirtualClock& operator=(const VirtualClock&) = delete;
+
+    /**
+     * @param now The simulation time.
+     *
+     * @returns The local time at simulation time @p now.
+     */
+    simtime local_time(simtime now) const
+    {
+        return frozen() ? frozen_at_ - offset_ : now - offset_;
+    }
+
+    /**
+     * @param local A local time.
+     *
+     * @returns The simulation time the clock reaches @p local at if it is not frozen again.
+     */
+    simtime to_global(simtime local) const { return local + offset_; }
+
+    /**
+     * @returns True if the clock is frozen.
+     */
+    bool frozen() const { return suspend_refs_ > 0; }
+
+    /**
+     * @brief Stops the clock. Suspensions nest, a node that is both failed
+     * and paused resumes when both have ended.
+     *
+     * @param now The simulation time.
+     *
+     * @returns True if the clock was running, the tick should then be removed.
+     */
+    bool freeze(simtime now)
+    {
+        if (suspend_refs_++ > 0)
+            return false;
+        frozen_at_ = now;
+        return true;
+    }
+
+    /**
+     * @brief Restarts the clock.
+     *
+     * @param now The simulation time.
+     *
+     * @returns True if the clock is running again and has pending events,
+     * the tick should then be scheduled at next_time().
+     */
+    bool thaw(simtime now)
+    {
+        if (suspend_refs_ == 0 || --suspend_refs_ > 0)
+            return false;
+        offset_ += now - frozen_at_;
+        return !pending_.empty();
+    }
+
+    /**
+     * @brief Adds an event.
+     *
+     * @param event The event.
+     * @param delay The local time until the event.
+     * @param now   The simulation time.
+     *
+     * @returns True if the event is now the first, the tick should then be moved.
+     */
+    bool schedule(Event *event, simtime delay, simtime now)
+    {
+        pending_.push(Pending{ local_time(now) + delay, sequence_++, event });
+        return pending_.top().event == event;
+    }
+
+    /**
+     * @brief Removes an event.
+     *
+     * @param event The event.
+     *
+     * @returns True if the first event changed, the tick should then be moved.
+     */
+    bool cancel(Event *event)
+    {
+        if (!pending_.contains(event))
+            return false;
+        bool first = pending_.top().event == event;
+        pending_.erase(event);
+        return first;
+    }
+
+    /**
+     * @param event A pending event.
+     * @param now   The simulation time.
+     *
+     * @returns The local time left until the event.
+     */
+    simtime remaining(Event *event, simtime now) const
+    {
+        return pending_.get(event).time - local_time(now);
+    }
+
+    /**
+     * @returns True if the event is pending on this clock.
+     */
+    bool contains(Event *event) const { return pending_.contains(event); }
+
+    /**
+     * @returns True if there are pending events.
+     */
+    bool has_pending() const { return !pending_.empty(); }
+
+    /**
+     * @returns The number of pending events.
+     */
+    size_t pending_count() const { return pending_.size(); }
+
+    /**
+     * @returns The simulation time of the first event, the clock must be
+     * running and have pending events.
+     */
+    simtime next_time() const { return to_global(pending_.top().time); }
+
+    /**
+     * @brief Takes the events that are due, in time order and in the order
+     * they were scheduled for equal times. Their event priorities do not
+     * reorder them.
+     *
+     * An event is due if next_time() would be at or before @p now, the same
+     * comparison the tick is scheduled by, so a tick always takes at least
+     * the event it was scheduled for.
+     *
+     * @param now    The simulation time.
+     * @param events Receives the due events.
+     */
+    void take_due(simtime now, std::vector<Event*>& events)
+    {
+        events.clear();
+        while (!pending_.empty() && to_global(pending_.top().time) <= now) {
+            events.push_back(pending_.top().event);
+            pending_.pop();
+        }
+    }
+
+    /**
+     * @brief Removes all events and restarts the clock.
+     */
+    void clear()
+    {
+        pending_.clear();
+        offset_ = 0;
+        frozen_at_ = 0;
+        suspend_refs_ = 0;
+        sequence_ = 0;
+    }
+
+private:
+    struct Pending {
+        simtime time;
+        uint64_t sequence;
+        Event *event;
+    };
+
+    struct Earlier {
+        bool operator()(const Pending& a, const Pending& b) const
+        {
+            return a.time < b.time || (a.time == b.time && a.sequence < b.sequence);
+        }
+    };
+
+    struct EventOf {
+        Event* operator()(const Pending& pending) const { return pending.event; }
+    };
+
+    IndexedHeap<Pending, Earlier, EventOf> pending_;
+    simtime offset_ = 0;
+    simtime frozen_at_ = 0;
+    int suspend_refs_ = 0;
+    uint64_t sequence_ = 0;
+};
+
+} // namespace xsim
+
+#endif // VIRTUALCLOCK_H
@@ -0,0 +1,299 @@
+#ifndef WAKEUPINDEX_H
+#define WAKEUPINDEX_H
+
+#include <xsim_config>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace xsim {
+
+class Entity;
+class Node;
+
+/**
+ * @brief Counts how well the wake-up index targets blocked entities.
+ */
+struct XSIM_EXPORT WakeupCounters {
+    /** @brief Blocked entities that were re-evaluated. */
+    uint64_t wakeups = 0;
+
+    /** @brief Re-evaluated entities that still could not move. */
+    uint64_t wasted = 0;
+
+    /**
+     * @brief Re-evaluated entities that could not move and were moved to
+     * the condition that blocks them now.
+     */
+    uint64_t resubscribed = 0;
+
+    /**
+     * @brief Woken entities that were skipped because they had moved or
+     * been unsubscribed by an earlier wake-up in the same pass.
+     */
+    uint64_t stale = 0;
+
+    /**
+     * @brief Entities waiting on any condition at the destination of each
+     * wake-up, the entities a full rescan of the destination would have
+     * re-evaluated.
+     */
+    uint64_t scanned_baseline = 0;
+
+    /**
+     * @returns The share of wake-ups that were wasted.
+     */
+    double wasted_ratio() const
+    {
+        return wakeups == 0 ? 0.0 : static_cast<double>(wasted) / wakeups;
+    }
+
+    /**
+     * @returns The share of the full rescan baseline that was re-evaluated.
+     */
+    double scanned_ratio() const
+    {
+        return scanned_baseline == 0 ? 0.0 : static_cast<double>(wakeups) / scanned_baseline;
+    }
+};
+
+/**
+ * @brief Maps blocking conditions to the entities waiting on them.
+ *
+ * An entity that is forward blocked subscribes to the destination it waits
+ * for together with the condition that blocks it: the variant of a variant
+ * specific enter logic, the enter logic itself, or null if it only waits for
+ * capacity. When something changes at a destination only the entities that
+ * wait on a condition that can now be satisfied are woken, instead of every
+ * blocked entity. An entity that may move to all successors subscribes at
+ * each of them.
+ *
+ * The woken entities are tried in the dispatch order of the destination.
+ * Each subscription carries a token, so an entity that was moved,
+ * unsubscribed or deleted by an earlier wake-up in the same pass is skipped.
+ * An entity that still cannot move is moved to the condition that blocks it
+ * now, so that it is woken when that condition changes.
+ */
+class WakeupIndex {
+public:
+    /** @brief A destination and a blocking condition. */
+    typedef std::pair<const Node*, const void*> Key;
+
+    /**
+     * @brief A subscribed entity, in the bucket of its destination and condition.
+     */
+    struct Entry {
+        Entity *entity;
+        Key key;
+        uint64_t token;
+    };
+
+    /**
+     * @brief A subscription, kept by the entity until it is unblocked.
+     */
+    struct Subscription {
+        std::list<Entry>::iterator position;
+        uint64_t token;
+    };
+
+    /**
+     * @brief An entity taken for a wake-up.
+     */
+    struct Woken {
+        Entity *entity;
+        uint64_t token;
+        std::list<Entry>::iterator position;
+    };
+
+    /**
+     * @brief The outcome of re-evaluating a woken entity.
+     */
+    struct Result {
+        /** @brief True if the entity could move. */
+        bool moved;
+
+        /** @brief The condition that blocks the entity now, if it could not move. */
+        const void *condition;
+    };
+
+    WakeupIndex() = default;
+
+    /** Copying and moving the index is not supported. */
+    WakeupIndex(const WakeupIndex&) = delete;
+    WakeupIndex& operator=(const WakeupIndex&) = delete;
+
+    /**
+     * @brief Subscribes a blocked entity.
+     *
+     * @param destination The destination the entity waits for.
+     * @param condition   The condition that blocks the entity, null for capacity.
+     * @param entity      The entity.
+     *
+     * @returns The subscription, to be passed to unsubscribe.
+     */
+    Subscription subscribe(const Node *destination, const void *condition, Entity *entity)
+    {
+        Key key(destination, condition);
+        Bucket& bucket = buckets_[key];
+        uint64_t token = ++tokens_;
+        bucket.push_back(Entry{ entity, key, token });
+        live_.insert(token);
+        ++waiting_[destination];
+        return Subscription{ std::prev(bucket.end()), token };
+    }
+
+    /**
+     * @brief Removes a subscription.
+     *
+     * @param subscription The subscription.
+     */
+    void unsubscribe(const Subscription& subscription)
+    {
+        if (live_.erase(subscription.token) == 0)
+            return;
+        Key key = subscription.position->key;
+        auto it = buckets_.find(key);
+        it->second.erase(subscription.position);
+        if (it->second.empty())
+            buckets_.erase(it);
+        auto waiting = waiting_.find(key.first);
+        if (--waiting->second == 0)
+            waiting_.erase(waiting);
+    }
+
+    /**
+     * @param token The token of a subscription.
+     *
+     * @returns True if the subscription has not been removed.
+     */
+    bool is_subscribed(uint64_t token) const { return live_.count(token) != 0; }
+
+    /**
+     * @brief Wakes the entities waiting on a condition at a destination.
+     *
+     * @param destination The destination where something changed.
+     * @param condition   The condition that may now be satisfied.
+     * @param order       Called with the woken entities in block order,
+     *                    sorts them in the dispatch order of the destination.
+     * @param try_move    Called with each woken entity that is still
+     *                    subscribed, returns a Result. It may unsubscribe
+     *                    the entity and subscribe it anew.
+     *
+     * @returns The number of entities that could move.
+     */
+    template <typename Order, typename TryMove>
+    size_t wake(const Node *destination, const void *condition, Order&& order, TryMove&& try_move)
+    {
+        counters_.scanned_baseline += waiting(destination);
+        auto it = buckets_.find(Key(destination, condition));
+        if (it == buckets_.end())
+            return 0;
+
+        // Copy since try_move changes the bucket and may wake other
+        // destinations recursively.
+        std::vector<Woken> woken;
+        woken.reserve(it->second.size());
+        for (auto position = it->second.begin(); position != it->second.end(); ++position)
+            woken.push_back(Woken{ position->entity, position->token, position });
+        order(woken);
+
+        size_t moved = 0;
+        for (const Woken& entry : woken) {
+            if (!is_subscribed(entry.token)) {
+                ++counters_.stale;
+                continue;
+            }
+            ++counters_.wakeups;
+            Result result = try_move(entry.entity);
+            if (result.moved) {
+                ++moved;
+                continue;
+            }
+            ++counters_.wasted;
+            if (is_subscribed(entry.token) && result.condition != entry.position->key.second) {
+                move(entry.position, result.condition);
+                ++counters_.resubscribed;
+            }
+        }
+        return moved;
+    }
+
+    /**
+     * @param destination The destination.
+     *
+     * @returns The number of entities waiting on any condition at the destination.
+     */
+    size_t waiting(const Node *destination) const
+    {
+        auto it = waiting_.find(destination);
+        return it != waiting_.end() ? it->second : 0;
+    }
+
+    /**
+     * @returns The wake-up counters.
+     */
+    const WakeupCounters& counters() const { return counters_; }
+
+    /**
+     * @brief Resets the wake-up counters, called when statistics are reset.
+     */
+    void reset_counters() { counters_ = WakeupCounters(); }
+
+    /**
+     * @brief Removes all subscriptions.
+     */
+    void clear()
+    {
+        buckets_.clear();
+        waiting_.clear();
+        live_.clear();
+        reset_counters();
+    }
+
+private:
+    typedef std::list<Entry> Bucket;
+
+    /**
+     * @brief Moves a subscription to another condition at the same
+     * destination. The list node is spliced, so the subscription held by
+     * the entity stays valid.
+     */
+    void move(std::list<Entry>::iterator position, const void *condition)
+    {
+        Key from = position->key;
+        Key to(from.first, condition);
+        Bucket& target = buckets_[to];
+        auto source = buckets_.find(from);
+        target.splice(target.end(), source->second, position);
+        position->key = to;
+        if (source->second.empty())
+            buckets_.erase(source);
+    }
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const
+        {
+            size_t a = std::hash<const void*>()(key.first);
+            size_t b = std::hash<const void*>()(key.second);
+            return a ^ (b + 0x9e3779b97f4a7c15ull + (a << 6) + (a >> 2));
+        }
+    };
+
+    std::unordered_map<Key, Bucket, KeyHash> buckets_;
+    std::unordered_map<const Node*, size_t> waiting_;
+
+    /** @brief The tokens of the current subscriptions. */
+    std::unordered_set<uint64_t> live_;
+    uint64_t tokens_ = 0;
+
+    WakeupCounters counters_;
+};
+
+} // namespace xsim
+
+#endif // WAKEUPINDEX_H
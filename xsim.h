@@ -1,133 +1,157 @@
-#include "activeperiod.h"
-#include "assembly.h"
-#include "assemblyspecification.h"
-#include "batch.h"
-#include "movestrategy.h"
-#include "movestrategycyclic.h"
-#include "movestrategyrandom.h"
-#include "movestrategysuccessor.h"
-#include "movestrategyweighted.h"
-#include "movestrategysequence.h"
-#include "movestrategysequenceentity.h"
-#include "entity.h"
-#include "breakpoint.h"
-#include "buffer.h"
-#include "capacitylimit.h"
-#include "capacitylimitvariant.h"
-#include "common.h"
-#include "component.h"
-#include "conveyor.h"
-#include "conveyoritem.h"
-#include "criticalwip.h"
-#include "demand.h"
-#include "disassembly.h"
-#include "dispatch.h"
-#include "dispatchorder.h"
-#include "dispatchspt.h"
-#include "dispatchsst.h"
-#include "double.h"
-#include "enterlogic.h"
-#include "enterport.h"
-#include "entitytime.h"
-#include "entrance.h"
-#include "event.h"
-#include "eventanimateconveyor.h"
-#include "eventassemble.h"
-#include "eventbatchtimeout.h"
-#include "eventbreakbegin.h"
-#include "eventbreakend.h"
-#include "eventcreatedemand.h"
-#include "eventcreateentity.h"
-#include "eventdisassemble.h"
-#include "eventdisruptionbegin.h"
-#include "eventdisruptionend.h"
-#include "evententrytimeout.h"
-#include "eventinfo.h"
-#include "eventopenconveyor.h"
-#include "eventout.h"
-#include "eventresetstats.h"
-#include "eventprocessingresourceready.h"
-#include "eventrepairresourceready.h"
-#include "eventsetupresourceready.h"
-#include "eventrequestprocessingresources.h"
-#include "eventrequestrepairresources.h"
-#include "eventrequestsetupresources.h"
-#include "eventsetupend.h"
-#include "eventshiftbegin.h"
-#include "eventshiftcalendarstart.h"
-#include "eventshiftend.h"
-#include "eventstartnewbatch.h"
-#include "eventtaktcomplete.h"
-#include "eventtimecallback.h"
-#include "eventtriggersynchronizedexits.h"
-#include "eventupdateconveyor.h"
-#include "exit.h"
-#include "exitlogic.h"
-#include "exitport.h"
-#include "failure.h"
-#include "facade.h"
-#include "flow.h"
-#include "flowselection.h"
-#include "flowgroup.h"
-#include "kanban.h"
-#include "failurezone.h"
-#include "int.h"
-#include "logbuffer.h"
-#include "logic.h"
-#include "logicskill.h"
-#include "logicresource.h"
-#include "maxwip.h"
-#include "movecontroller.h"
-#include "movecontrollerflow.h"
-#include "node.h"
-#include "noderesource.h"
-#include "nodeskill.h"
-#include "note.h"
-#include "nopexitport.h"
-#include "object.h"
-#include "operation.h"
-#include "order.h"
-#include "output.h"
-#include "paralleloperation.h"
-#include "paralleloperationexitport.h"
-#include "paralleloperationexitlogic.h"
-#include "paralleloperationoperation.h"
-#include "poolallocator.h"
-#include "prioritysignal.h"
-#include "propertycontainer.h"
-#include "resourcemanager.h"
-#include "selection.h"
-#include "setuptable.h"
-#include "shift.h"
-#include "shiftcalendar.h"
-#include "simulation.h"
-#include "sink.h"
-#include "signal.hpp"
-#include "source.h"
-#include "store.h"
-#include "takt.h"
-#include "numbergeneratorbeta.h"
-#include "numbergeneratorbounded.h"
-#include "numbergeneratorbinomial.h"
-#include "numbergeneratorconst.h"
-#include "numbergeneratordiscreteuniform.h"
-#include "numbergeneratorept.h"
-#include "numbergeneratorerlang.h"
-#include "numbergeneratorexponential.h"
-#include "numbergeneratorgamma.h"
-#include "numbergeneratorweibull.h"
-#include "numbergenerator.h"
-#include "numbergeneratorlist.h"
-#include "numbergeneratorlognormal.h"
-#include "numbergeneratornegativebinomial.h"
-#include "numbergeneratornormal.h"
-#include "numbergeneratorsequence.h"
-#include "numbergeneratortable.h"
-#include "numbergeneratortriangle.h"
-#include "numbergeneratoruniform.h"
-#include "variant.h"
-#include "variantcreator.h"
-#include "variantcreatorrandom.h"
-#include "variantcreatorsequence.h"
-#include "variantcreatordelivery.h"
-#include "xsim_config"
+#include "activeperiod.h"
+#include "assembly.h"
+#include "assemblyspecification.h"
+#include "batch.h"
+#include "batchindex.h"
+#include "movestrategy.h"
+#include "movestrategycyclic.h"
+#include "movestrategyrandom.h"
+#include "movestrategysuccessor.h"
+#include "movestrategyweighted.h"
+#include "movestrategysequence.h"
+#include "movestrategysequenceentity.h"
+#include "entity.h"
+#include "breakpoint.h"
+#include "buffer.h"
+#include "calendarstate.h"
+#include "capacitylimit.h"
+#include "capacitylimitvariant.h"
+#include "common.h"
+#include "component.h"
+#include "conveyor.h"
+#include "conveyoritem.h"
+#include "conveyortrack.h"
+#include "criticalwip.h"
+#include "demand.h"
+#include "disassembly.h"
+#include "disruptionwalk.h"
+#include "dispatch.h"
+#include "dispatchorder.h"
+#include "dispatchspt.h"
+#include "dispatchsst.h"
+#include "double.h"
+#include "enterlogic.h"
+#include "enterport.h"
+#include "entitysidetable.h"
+#include "entitytime.h"
+#include "entrance.h"
+#include "event.h"
+#include "eventanimateconveyor.h"
+#include "eventassemble.h"
+#include "eventbatchtimeout.h"
+#include "eventbreakbegin.h"
+#include "eventbreakend.h"
+#include "eventclocktick.h"
+#include "eventcreatedemand.h"
+#include "eventcreateentity.h"
+#include "eventdisassemble.h"
+#include "eventdisruptionbegin.h"
+#include "eventdisruptionend.h"
+#include "evententrytimeout.h"
+#include "eventinfo.h"
+#include "eventopenconveyor.h"
+#include "eventout.h"
+#include "eventpublishframe.h"
+#include "eventresetstats.h"
+#include "eventprocessingresourceready.h"
+#include "eventrepairresourceready.h"
+#include "eventsetupresourceready.h"
+#include "eventrequestprocessingresources.h"
+#include "eventrequestrepairresources.h"
+#include "eventrequestsetupresources.h"
+#include "eventsetupend.h"
+#include "eventshiftbegin.h"
+#include "eventshiftcalendarstart.h"
+#include "eventshiftend.h"
+#include "eventstartnewbatch.h"
+#include "eventtaktcomplete.h"
+#include "eventtimecallback.h"
+#include "eventtriggersynchronizedexits.h"
+#include "eventupdateconveyor.h"
+#include "exit.h"
+#include "exitlogic.h"
+#include "exitport.h"
+#include "expression.h"
+#include "failure.h"
+#include "facade.h"
+#include "flow.h"
+#include "flowselection.h"
+#include "flowgroup.h"
+#include "kanban.h"
+#include "kitmatcher.h"
+#include "failuretimeline.h"
+#include "failurezone.h"
+#include "framepublisher.h"
+#include "int.h"
+#include "indexedheap.h"
+#include "intrusivelist.h"
+#include "logbuffer.h"
+#include "logic.h"
+#include "logicskill.h"
+#include "logicresource.h"
+#include "maxwip.h"
+#include "modulecache.h"
+#include "movecontroller.h"
+#include "movecontrollerflow.h"
+#include "node.h"
+#include "noderesource.h"
+#include "nodeskill.h"
+#include "note.h"
+#include "nopexitport.h"
+#include "object.h"
+#include "operation.h"
+#include "order.h"
+#include "output.h"
+#include "paralleloperation.h"
+#include "paralleloperationexitport.h"
+#include "paralleloperationexitlogic.h"
+#include "paralleloperationoperation.h"
+#include "poolallocator.h"
+#include "prioritysignal.h"
+#include "propertycontainer.h"
+#include "propertyschema.h"
+#include "resourcemanager.h"
+#include "selection.h"
+#include "setuptable.h"
+#include "setupmatrix.h"
+#include "shift.h"
+#include "shiftcalendar.h"
+#include "simulation.h"
+#include "skillmatcher.h"
+#include "sink.h"
+#include "signal.hpp"
+#include "source.h"
+#include "store.h"
+#include "storecontents.h"
+#include "stringtable.h"
+#include "takt.h"
+#include "numbergeneratorbeta.h"
+#include "numbergeneratorbounded.h"
+#include "numbergeneratorbinomial.h"
+#include "numbergeneratorconst.h"
+#include "numbergeneratordiscreteuniform.h"
+#include "numbergeneratorept.h"
+#include "numbergeneratorerlang.h"
+#include "numbergeneratorexponential.h"
+#include "numbergeneratorgamma.h"
+#include "numbergeneratorweibull.h"
+#include "numbergenerator.h"
+#include "numbergeneratorlist.h"
+#include "numbergeneratorlognormal.h"
+#include "numbergeneratornegativebinomial.h"
+#include "numbergeneratornormal.h"
+#include "numbergeneratorsequence.h"
+#include "numbergeneratortable.h"
+#include "numbergeneratortriangle.h"
+#include "numbergeneratoruniform.h"
+#include "variable.h"
+#include "variant.h"
+#include "variantcreator.h"
+#include "variantcreatorrandom.h"
+#include "variantcreatorsequence.h"
+#include "variantcreatordelivery.h"
+#include "variantmap.h"
+#include "virtualclock.h"
+#include "wakeupindex.h"
+#include "variatestream.h"
+#include "xsim_config"